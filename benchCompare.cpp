@@ -0,0 +1,254 @@
+/***********************************************************************
+ * Source File:
+ *    BENCH COMPARE
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    Compare the benchmark history of two commits and flag the
+ *    benchmarks that got slower. Timings are noisy, so one run of each
+ *    proves nothing: run bench and benchMicro several times on each
+ *    commit, then a Mann-Whitney U test says whether the new runs are
+ *    slower than the old by more than chance. Only runs on the same
+ *    processor are compared with each other.
+ *
+ *    usage: benchCompare [-f file] [-a alpha] [base new]
+ *       With no commits given, the last commit in the history is
+ *       compared with the one before it
+ ************************************************************************/
+
+#include "benchHistory.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+using namespace std;
+
+const int MIN_RUNS  = 3;     // fewer than this on either side can not be judged
+const int EXACT_MAX = 400;   // counted exactly up to this many pairs of runs
+
+/***************************************************
+ * EXACT TAIL
+ * The chance that u or fewer of the pairs have the
+ * new value larger, counting every ordering of the
+ * values: the largest is either a new one, larger
+ * than every base one, or a base one. Only right
+ * when no two values are the same
+ **************************************************/
+static double exactTail(int nNext, int nBase, double u)
+{
+   // ways[i][j][k]: orderings of i new and j base values with k such pairs
+   vector<vector<vector<double>>> ways(nNext + 1, vector<vector<double>>(nBase + 1));
+   for (int i = 0; i <= nNext; i++)
+      for (int j = 0; j <= nBase; j++)
+      {
+         vector<double>& w = ways[i][j];
+         w.assign(i * j + 1, 0.0);
+         if (i == 0 || j == 0)
+         {
+            w[0] = 1.0;
+            continue;
+         }
+         for (int k = 0; k <= i * j; k++)
+         {
+            if (k >= j)
+               w[k] += ways[i - 1][j][k - j];
+            if (k <= i * (j - 1))
+               w[k] += ways[i][j - 1][k];
+         }
+      }
+
+   const vector<double>& w = ways[nNext][nBase];
+   double below = 0.0;
+   double total = 0.0;
+   for (int k = 0; k < (int)w.size(); k++)
+   {
+      total += w[k];
+      if (k <= u)
+         below += w[k];
+   }
+   return below / total;
+}
+
+/***************************************************
+ * MANN WHITNEY
+ * The chance of seeing samples this far apart if
+ * both came from the same distribution, one-sided:
+ * small when the new samples tend to be smaller
+ * than the base ones. A handful of runs is counted
+ * exactly, since the normal approximation claims
+ * too much there: 3 against 3 can do no better than
+ * 1 in 20. Otherwise ranks are averaged over ties,
+ * and the approximation is corrected for the ties
+ * and for continuity
+ **************************************************/
+static double mannWhitney(const vector<double>& base, const vector<double>& next)
+{
+   // Rank everything together, remembering which side each came from
+   vector<pair<double, bool>> all;
+   for (double value : base)
+      all.push_back(make_pair(value, false));
+   for (double value : next)
+      all.push_back(make_pair(value, true));
+   sort(all.begin(), all.end());
+
+   double n = (double)all.size();
+   double rankNext = 0.0;
+   double ties = 0.0;
+   for (size_t i = 0; i < all.size(); )
+   {
+      size_t j = i;
+      while (j < all.size() && all[j].first == all[i].first)
+         j++;
+      double rank = (i + 1 + j) / 2.0;    // the average of ranks i+1 through j
+      double t = (double)(j - i);
+      ties += t * t * t - t;
+      for (size_t k = i; k < j; k++)
+         if (all[k].second)
+            rankNext += rank;
+      i = j;
+   }
+
+   double nBase = (double)base.size();
+   double nNext = (double)next.size();
+   double u = rankNext - nNext * (nNext + 1.0) / 2.0;
+   if (ties == 0.0 && nBase * nNext <= EXACT_MAX)
+      return exactTail((int)next.size(), (int)base.size(), u);
+
+   double mean = nBase * nNext / 2.0;
+   double variance = nBase * nNext / 12.0 * ((n + 1.0) - ties / (n * (n - 1.0)));
+   if (variance <= 0.0)
+      return 1.0;                          // every value the same
+   double z = (u - mean + 0.5) / sqrt(variance);
+   return 0.5 * erfc(-z / sqrt(2.0));     // P(Z <= z)
+}
+
+/***************************************************
+ * MEDIAN
+ **************************************************/
+static double median(vector<double> values)
+{
+   sort(values.begin(), values.end());
+   size_t mid = values.size() / 2;
+   return values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2.0;
+}
+
+/***************************************************
+ * SAMPLES
+ * Every run of one benchmark on one processor,
+ * split by commit
+ **************************************************/
+struct Samples
+{
+   string unit;
+   map<string, vector<double>> byCommit;
+};
+
+/***************************************************
+ * MAIN
+ * Returns 1 if anything got slower, so a script can
+ * stop on it
+ **************************************************/
+int main(int argc, char** argv)
+{
+   string fileName = HISTORY_FILE;
+   double alpha = 0.05;
+   vector<string> commits;
+   for (int i = 1; i < argc; i++)
+   {
+      string arg = argv[i];
+      if (arg == "-f" && i + 1 < argc)
+         fileName = argv[++i];
+      else if (arg == "-a" && i + 1 < argc)
+         alpha = atof(argv[++i]);
+      else if (arg[0] != '-')
+         commits.push_back(arg);
+      else
+      {
+         printf("usage: %s [-f file] [-a alpha] [base new]\n", argv[0]);
+         return 2;
+      }
+   }
+
+   // Read the history, keeping the order the commits were last run in
+   ifstream in(fileName);
+   if (!in)
+   {
+      printf("no history in %s: run bench or benchMicro first\n", fileName.c_str());
+      return 2;
+   }
+   map<string, Samples> benchmarks;        // keyed by cpu, tool and name
+   vector<string> order;
+   string line;
+   HistoryRecord record;
+   while (getline(in, line))
+   {
+      if (!parseHistory(line, record))
+         continue;
+      Samples& samples = benchmarks[record.cpu + " | " + record.tool + " | " + record.name];
+      samples.unit = record.unit;
+      samples.byCommit[record.commit].push_back(record.value);
+      order.erase(remove(order.begin(), order.end(), record.commit), order.end());
+      order.push_back(record.commit);
+   }
+
+   // Which two commits
+   if (commits.empty() && order.size() >= 2)
+   {
+      commits.push_back(order[order.size() - 2]);
+      commits.push_back(order[order.size() - 1]);
+   }
+   if (commits.size() != 2)
+   {
+      printf("need two commits to compare\n");
+      return 2;
+   }
+   const string& base = commits[0];
+   const string& next = commits[1];
+   printf("base %s  vs  new %s   (alpha %.3g)\n\n", base.c_str(), next.c_str(), alpha);
+
+   // Each benchmark run on both
+   int numSlower = 0;
+   int numCompared = 0;
+   for (const auto& benchmark : benchmarks)
+   {
+      const Samples& samples = benchmark.second;
+      auto itBase = samples.byCommit.find(base);
+      auto itNext = samples.byCommit.find(next);
+      if (itBase == samples.byCommit.end() || itNext == samples.byCommit.end())
+         continue;
+      const vector<double>& before = itBase->second;
+      const vector<double>& after  = itNext->second;
+
+      double medianBefore = median(before);
+      double medianAfter  = median(after);
+      double change = medianBefore != 0.0 ?
+                      100.0 * (medianAfter - medianBefore) / medianBefore : 0.0;
+      printf("%-60s %12.2f -> %12.2f %-3s %+6.1f%%  (%d vs %d runs)",
+             benchmark.first.c_str(), medianBefore, medianAfter,
+             samples.unit.c_str(), change, (int)before.size(), (int)after.size());
+      if ((int)before.size() < MIN_RUNS || (int)after.size() < MIN_RUNS)
+      {
+         printf("  too few runs\n");
+         continue;
+      }
+      numCompared++;
+
+      // Slower means fewer nodes per second, or more nanoseconds per call
+      bool fHigherIsBetter = (samples.unit == "nps");
+      double p = fHigherIsBetter ? mannWhitney(before, after) : mannWhitney(after, before);
+      if (p < alpha)
+      {
+         printf("  SLOWER (p = %.4f)\n", p);
+         numSlower++;
+      }
+      else
+         printf("  ok (p = %.4f)\n", p);
+   }
+
+   printf("\n%d of %d benchmarks significantly slower\n", numSlower, numCompared);
+   return numSlower ? 1 : 0;
+}
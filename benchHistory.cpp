@@ -0,0 +1,167 @@
+/***********************************************************************
+ * Source File:
+ *    BENCH HISTORY
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    Write benchmark results to the history file and read them back
+ ************************************************************************/
+
+#include "benchHistory.h"
+#include "cpu.h"        // for cpuName()
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+using namespace std;
+
+#if defined(_WIN32)
+#define popen  _popen
+#define pclose _pclose
+const char QUIET[] = " 2>nul";
+#else
+const char QUIET[] = " 2>/dev/null";
+#endif
+
+/***************************************************
+ * RUN
+ * The first line a shell command prints, without
+ * the newline, or nothing if it failed
+ **************************************************/
+static string run(const char* command)
+{
+   string full = string(command) + QUIET;
+   FILE* pipe = popen(full.c_str(), "r");
+   if (pipe == nullptr)
+      return string();
+   char buf[256];
+   string line;
+   if (fgets(buf, sizeof(buf), pipe) != nullptr)
+      line = buf;
+   pclose(pipe);
+   while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
+      line.pop_back();
+   return line;
+}
+
+/***************************************************
+ * HISTORY COMMIT
+ * The commit checked out in the current directory
+ * now, which is only the one the program was built
+ * from if nothing was checked out since. Marked
+ * "-dirty", with a warning, if the tracked files
+ * have changed, because then the commit alone does
+ * not say what was measured
+ **************************************************/
+string historyCommit()
+{
+   string commit = run("git rev-parse --short HEAD");
+   if (commit.empty())
+      return "unknown";
+   if (!run("git status --porcelain --untracked-files=no").empty())
+   {
+      fprintf(stderr, "warning: the tree has changed since %s, so these "
+                      "results are kept as %s-dirty\n", commit.c_str(), commit.c_str());
+      commit += "-dirty";
+   }
+   return commit;
+}
+
+/***************************************************
+ * HISTORY CPU
+ **************************************************/
+string historyCpu()
+{
+   char name[49];
+   cpuName(name);
+   return name[0] ? string(name) : string("unknown");
+}
+
+/***************************************************
+ * QUOTE
+ * A string as JSON writes it
+ **************************************************/
+static string quote(const string& text)
+{
+   string quoted = "\"";
+   for (char ch : text)
+   {
+      if (ch == '"' || ch == '\\')
+         quoted += '\\';
+      quoted += ch;
+   }
+   return quoted + "\"";
+}
+
+/***************************************************
+ * APPEND HISTORY
+ * One line per result, with the time it was taken
+ **************************************************/
+bool appendHistory(const HistoryRecord& record, const char* fileName)
+{
+   FILE* file = fopen(fileName, "a");
+   if (file == nullptr)
+      return false;
+
+   char stamp[32];
+   time_t now = time(nullptr);
+   strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+   fprintf(file, "{\"time\":\"%s\",\"tool\":%s,\"name\":%s,\"commit\":%s,"
+                 "\"cpu\":%s,\"unit\":%s,\"value\":%.6g}\n",
+           stamp, quote(record.tool).c_str(), quote(record.name).c_str(),
+           quote(record.commit).c_str(), quote(record.cpu).c_str(),
+           quote(record.unit).c_str(), record.value);
+   return fclose(file) == 0;
+}
+
+/***************************************************
+ * FIELD
+ * Find "key": in a line and return where its value
+ * starts, or npos
+ **************************************************/
+static size_t field(const string& line, const char* key)
+{
+   string pattern = string("\"") + key + "\":";
+   size_t at = line.find(pattern);
+   return at == string::npos ? at : at + pattern.size();
+}
+
+/***************************************************
+ * STRING FIELD
+ **************************************************/
+static bool stringField(const string& line, const char* key, string& value)
+{
+   size_t at = field(line, key);
+   if (at == string::npos || at >= line.size() || line[at] != '"')
+      return false;
+   value.clear();
+   for (at++; at < line.size() && line[at] != '"'; at++)
+   {
+      if (line[at] == '\\' && at + 1 < line.size())
+         at++;
+      value += line[at];
+   }
+   return at < line.size();
+}
+
+/***************************************************
+ * PARSE HISTORY
+ * Only the lines appendHistory() writes need to be
+ * understood, so this is not a general JSON reader
+ **************************************************/
+bool parseHistory(const string& line, HistoryRecord& record)
+{
+   if (!stringField(line, "tool",   record.tool)   ||
+       !stringField(line, "name",   record.name)   ||
+       !stringField(line, "commit", record.commit) ||
+       !stringField(line, "cpu",    record.cpu)    ||
+       !stringField(line, "unit",   record.unit))
+      return false;
+
+   size_t at = field(line, "value");
+   if (at == string::npos)
+      return false;
+   char* end = nullptr;
+   record.value = strtod(line.c_str() + at, &end);
+   return end != line.c_str() + at;
+}
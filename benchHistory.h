@@ -0,0 +1,44 @@
+/***********************************************************************
+ * Header File:
+ *    BENCH HISTORY
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    Every benchmark run adds its results to a local file, one JSON
+ *    object per line, tagged with the git commit and the processor.
+ *    benchCompare reads the file back to find slowdowns between commits
+ ************************************************************************/
+
+#pragma once
+
+#include <string>
+
+// where the results go, in the directory the benchmark is run from
+const char HISTORY_FILE[] = "benchHistory.jsonl";
+
+/***************************************************
+ * HISTORY RECORD
+ * One result of one run. A value in "nps" is better
+ * when it is higher; one in "ns" when it is lower
+ **************************************************/
+struct HistoryRecord
+{
+   std::string tool;      // which program: "bench", "benchMicro"
+   std::string name;      // which benchmark within it
+   std::string commit;    // git commit checked out where it ran
+   std::string cpu;       // processor it ran on
+   std::string unit;      // "nps" or "ns"
+   double      value;
+};
+
+// the commit and processor to tag a run with. The commit is asked of
+// git in the current directory when the program runs, not when it was
+// built, so run a benchmark from the tree it was built from
+std::string historyCommit();
+std::string historyCpu();
+
+// add one line to the history, returning false if it could not be written
+bool appendHistory(const HistoryRecord& record, const char* fileName = HISTORY_FILE);
+
+// read a line written by appendHistory(), returning false if it is not one
+bool parseHistory(const std::string& line, HistoryRecord& record);
@@ -0,0 +1,220 @@
+/***********************************************************************
+ * Source File:
+ *    BENCH MICRO
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    Nanoseconds per call for the small operations everything else is
+ *    built on: making and parsing a Position, reading a Move, moving
+ *    on the Board, looking up a square, and each piece's getMoves().
+ *    Each one is warmed up, then timed over many samples of many
+ *    calls, and the median and 99th percentile per call are written
+ *    out as JSON so the numbers can be compared from commit to commit.
+ *    The medians are also added to the benchmark history
+ ************************************************************************/
+
+#include "board.h"
+#include "move.h"
+#include "position.h"
+#include "piece.h"
+#include "benchHistory.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+using namespace std;
+
+const int NUM_WARMUP  = 50;     // samples thrown away first
+const int NUM_SAMPLES = 1000;   // samples kept
+const int NUM_OPS     = 1000;   // calls per sample
+
+// the positions the board and piece benchmarks run on
+const char* const FENS[] =
+{
+   FEN_START,
+   "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+   "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"
+};
+const int NUM_FENS = sizeof(FENS) / sizeof(FENS[0]);
+
+// every result is folded in here and printed, so no call can be thrown away
+static uint64_t checksum = 0;
+
+/***************************************************
+ * RESULT
+ * The timing of one benchmark, per call
+ **************************************************/
+struct Result
+{
+   const char* name;
+   double median;
+   double p99;
+   double mean;
+};
+
+/***************************************************
+ * MEASURE
+ * Run setup() untimed before each sample, then time
+ * op(i) for NUM_OPS values of i. The first NUM_WARMUP
+ * samples warm the caches and are not kept
+ **************************************************/
+template <class SETUP, class OP>
+static Result measure(const char* name, SETUP setup, OP op)
+{
+   vector<double> ns;
+   ns.reserve(NUM_SAMPLES);
+   for (int sample = 0; sample < NUM_WARMUP + NUM_SAMPLES; sample++)
+   {
+      setup();
+      auto begin = chrono::steady_clock::now();
+      for (int i = 0; i < NUM_OPS; i++)
+         op(i);
+      auto end = chrono::steady_clock::now();
+      if (sample >= NUM_WARMUP)
+         ns.push_back(chrono::duration<double, nano>(end - begin).count() / NUM_OPS);
+   }
+
+   sort(ns.begin(), ns.end());
+   double sum = 0.0;
+   for (double t : ns)
+      sum += t;
+   Result result;
+   result.name   = name;
+   result.median = ns[ns.size() / 2];
+   result.p99    = ns[min(ns.size() - 1, ns.size() * 99 / 100)];
+   result.mean   = sum / ns.size();
+   return result;
+}
+
+/***************************************************
+ * NOTHING
+ * For the benchmarks with no setup between samples
+ **************************************************/
+static void nothing() {}
+
+/***************************************************
+ * BENCH PIECE
+ * Time getMoves() for every piece of one type found
+ * in the benchmark positions, taking turns
+ **************************************************/
+static Result benchPiece(const char* name, PieceType pt,
+                         const vector<Board*>& boards)
+{
+   vector<pair<const Piece*, const Board*>> pieces;
+   for (const Board* pBoard : boards)
+      for (int location = 0; location < 64; location++)
+      {
+         const Piece& piece = (*pBoard)[Position(location)];
+         if (piece.getType() == pt && piece.isWhite() == pBoard->whiteTurn())
+            pieces.push_back(make_pair(&piece, pBoard));
+      }
+
+   return measure(name, nothing, [&](int i)
+   {
+      const pair<const Piece*, const Board*>& p = pieces[i % pieces.size()];
+      MoveList moves;
+      p.first->getMoves(moves, *p.second);
+      checksum += moves.size();
+   });
+}
+
+/***************************************************
+ * MAIN
+ **************************************************/
+int main()
+{
+   vector<Result> results;
+
+   // Position: made from a column and row, and parsed from text
+   results.push_back(measure("Position(c,r)", nothing, [](int i)
+   {
+      Position pos(i & 7, (i >> 3) & 7);
+      checksum += pos.getLocation();
+   }));
+   const char* const squares[8] = { "a1", "h8", "e4", "d5", "b7", "g2", "c3", "f6" };
+   results.push_back(measure("Position(text)", nothing, [&](int i)
+   {
+      Position pos(squares[i & 7]);
+      checksum += pos.getLocation();
+   }));
+
+   // Move::read, one of each kind of move
+   const char* const texts[8] = { "e2e4", "g1f3", "e4d5p", "e1g1c",
+                                  "e1c1C", "e5f6E", "a7a8Q", "b7a8rQ" };
+   Move move;
+   results.push_back(measure("Move::read", nothing, [&](int i)
+   {
+      move.read(texts[i & 7]);
+      checksum += move.getCode().raw();
+   }));
+
+   // The boards, with Piece views, for the rest
+   vector<Board*> boards;
+   for (int i = 0; i < NUM_FENS; i++)
+   {
+      boards.push_back(new Board(nullptr));
+      boards.back()->setFEN(FENS[i]);
+   }
+
+   // Board::operator[], visiting every square in turn
+   const Board& lookup = *boards[1];
+   results.push_back(measure("Board::operator[]", nothing, [&](int i)
+   {
+      checksum += lookup[Position(i & 63)].getType();
+   }));
+
+   // Board::move: knights out and back, so the position repeats.
+   // The board is set up again before each sample, untimed
+   Board& board = *boards[0];
+   const Move knights[4] = { Move("g1f3"), Move("g8f6"), Move("f3g1"), Move("f6g8") };
+   results.push_back(measure("Board::move",
+      [&]() { board.setFEN(FEN_START); },
+      [&](int i)
+   {
+      board.move(knights[i & 3]);
+      checksum += board.getHash();
+   }));
+   board.setFEN(FENS[0]);
+
+   // Each piece's getMoves()
+   results.push_back(benchPiece("Knight::getMoves", KNIGHT, boards));
+   results.push_back(benchPiece("Bishop::getMoves", BISHOP, boards));
+   results.push_back(benchPiece("Rook::getMoves",   ROOK,   boards));
+   results.push_back(benchPiece("Queen::getMoves",  QUEEN,  boards));
+   results.push_back(benchPiece("King::getMoves",   KING,   boards));
+   results.push_back(benchPiece("Pawn::getMoves",   PAWN,   boards));
+
+   for (Board* pBoard : boards)
+      delete pBoard;
+
+   // The JSON, one benchmark per line
+   printf("{\n");
+   printf("  \"samples\": %d,\n", NUM_SAMPLES);
+   printf("  \"opsPerSample\": %d,\n", NUM_OPS);
+   printf("  \"checksum\": \"%016llx\",\n", (unsigned long long)checksum);
+   printf("  \"benchmarks\": [\n");
+   for (size_t i = 0; i < results.size(); i++)
+      printf("    { \"name\": \"%s\", \"medianNs\": %.2f, \"p99Ns\": %.2f, \"meanNs\": %.2f }%s\n",
+             results[i].name, results[i].median, results[i].p99, results[i].mean,
+             i + 1 < results.size() ? "," : "");
+   printf("  ]\n");
+   printf("}\n");
+
+   // Keep the medians for benchCompare
+   HistoryRecord record;
+   record.tool   = "benchMicro";
+   record.commit = historyCommit();
+   record.cpu    = historyCpu();
+   record.unit   = "ns";
+   for (const Result& result : results)
+   {
+      record.name  = result.name;
+      record.value = result.median;
+      if (!appendHistory(record))
+      {
+         fprintf(stderr, "could not write %s\n", HISTORY_FILE);
+         break;
+      }
+   }
+   return 0;
+}
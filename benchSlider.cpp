@@ -0,0 +1,140 @@
+/***********************************************************************
+ * Source File:
+ *    BENCH SLIDER
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    How many slider attack lookups per second each backend manages,
+ *    and how many whole-side set-wise fills per second each kernel does.
+ *    Every backend runs the same fixed list of squares and blocker
+ *    sets, so the numbers can be compared run to run
+ ************************************************************************/
+
+#include "slider.h"
+#include "cpu.h"         // for cpuHasAvx2()
+#include <chrono>
+#include <cstdio>
+#include <vector>
+using namespace std;
+
+const int NUM_SAMPLES = 4096;       // distinct (square, occupancy) pairs
+const int NUM_PASSES  = 2000;       // times through the list per backend
+
+/***************************************************
+ * SAMPLE
+ * One square and the pieces around it
+ **************************************************/
+struct Sample
+{
+   int      location;
+   Bitboard occupied;
+};
+
+/***************************************************
+ * MAKE SAMPLES
+ * Random squares with about a quarter of the board
+ * occupied, from a fixed seed
+ **************************************************/
+static vector<Sample> makeSamples()
+{
+   vector<Sample> samples(NUM_SAMPLES);
+   uint64_t state = 0x2545F4914F6CDD1DULL;
+   for (Sample& sample : samples)
+   {
+      Bitboard a, b;
+      state ^= state << 13; state ^= state >> 7; state ^= state << 17; a = state;
+      state ^= state << 13; state ^= state >> 7; state ^= state << 17; b = state;
+      sample.location = (int)(a >> 58);
+      sample.occupied = a & b;
+   }
+   return samples;
+}
+
+/***************************************************
+ * RUN
+ * Time rook, bishop and queen lookups over every sample.
+ * The results are folded into a checksum so the compiler
+ * cannot throw the lookups away
+ **************************************************/
+static void run(const char* name, const vector<Sample>& samples)
+{
+   Bitboard checksum = BB_EMPTY;
+
+   // warm the caches and the branch predictor
+   for (const Sample& sample : samples)
+      checksum ^= queenAttacks(sample.location, sample.occupied);
+
+   auto begin = chrono::steady_clock::now();
+   for (int pass = 0; pass < NUM_PASSES; pass++)
+      for (const Sample& sample : samples)
+      {
+         checksum ^= rookAttacks(sample.location, sample.occupied ^ checksum);
+         checksum ^= bishopAttacks(sample.location, sample.occupied);
+         checksum ^= queenAttacks(sample.location, sample.occupied ^ (checksum & BB_RANK_1));
+      }
+   auto end = chrono::steady_clock::now();
+
+   double seconds = chrono::duration<double>(end - begin).count();
+   double lookups = 4.0 * NUM_PASSES * NUM_SAMPLES;   // a queen is a rook and a bishop
+   printf("%-6s %10.1f M lookups/sec   (%.3f sec, checksum %016llx)\n",
+          name, lookups / seconds / 1e6, seconds,
+          (unsigned long long)checksum);
+}
+
+/***************************************************
+ * RUN SET-WISE
+ * Time one whole-side fill per sample: its square
+ * holds a rook, and a queen sits on the mirror square
+ **************************************************/
+static void runSetwise(const char* name, SliderSetAttacks kernel,
+                       const vector<Sample>& samples)
+{
+   Bitboard checksum = BB_EMPTY;
+
+   for (const Sample& sample : samples)
+      checksum ^= kernel(squareBit(sample.location), BB_EMPTY, sample.occupied);
+
+   auto begin = chrono::steady_clock::now();
+   for (int pass = 0; pass < NUM_PASSES; pass++)
+      for (const Sample& sample : samples)
+      {
+         Bitboard queen = squareBit(sample.location ^ 63);
+         checksum ^= kernel(squareBit(sample.location) | queen, queen,
+                            sample.occupied ^ (checksum & BB_RANK_1));
+      }
+   auto end = chrono::steady_clock::now();
+
+   double seconds = chrono::duration<double>(end - begin).count();
+   double fills = (double)NUM_PASSES * NUM_SAMPLES;
+   printf("%-6s %10.1f M fills/sec     (%.3f sec, checksum %016llx)\n",
+          name, fills / seconds / 1e6, seconds,
+          (unsigned long long)checksum);
+}
+
+/***************************************************
+ * MAIN
+ **************************************************/
+int main()
+{
+   vector<Sample> samples = makeSamples();
+   SliderBackend chosen = sliderBackend;
+
+   printf("startup backend: %s\n", chosen == SLIDER_PEXT ? "pext" : "magic");
+
+   setSliderBackend(SLIDER_MAGIC);
+   run("magic", samples);
+
+   if (setSliderBackend(SLIDER_PEXT))
+      run("pext", samples);
+   else
+      printf("pext   not available on this CPU\n");
+
+   setSliderBackend(chosen);
+
+   runSetwise("scalar", sliderSetAttacksScalar, samples);
+   if (cpuHasAvx2())
+      runSetwise("avx2", sliderSetAttacksAvx2, samples);
+   else
+      printf("avx2   not available on this CPU\n");
+   return 0;
+}
@@ -0,0 +1,104 @@
+/***********************************************************************
+ * Header File:
+ *    BITBOARD
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    A set of squares packed into one 64-bit integer. Bit N is the
+ *    square at location N (row * 8 + col), so a1 is bit 0 and h8 is bit 63
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cassert>
+
+#if defined(_MSC_VER)
+#include <intrin.h>    // for _BitScanForward64 and __popcnt64
+#endif
+
+typedef uint64_t Bitboard;
+
+/***********************************************
+ * COLOR
+ * Which side a piece or a bitboard belongs to
+ **********************************************/
+enum Color { WHITE = 0, BLACK = 1 };
+
+inline Color colorFrom(bool fWhite) { return fWhite ? WHITE : BLACK; }
+
+// a few handy constant sets
+const Bitboard BB_EMPTY  = 0x0000000000000000ULL;
+const Bitboard BB_FULL   = 0xffffffffffffffffULL;
+const Bitboard BB_FILE_A = 0x0101010101010101ULL;
+const Bitboard BB_FILE_H = 0x8080808080808080ULL;
+const Bitboard BB_RANK_1 = 0x00000000000000ffULL;
+const Bitboard BB_RANK_8 = 0xff00000000000000ULL;
+
+/***********************************************
+ * SQUARE BIT
+ * The set containing just one location
+ **********************************************/
+inline Bitboard squareBit(int location)
+{
+   assert(0 <= location && location < 64);
+   return 1ULL << location;
+}
+
+inline Bitboard squareBit(int c, int r)
+{
+   return squareBit(r * 8 + c);
+}
+
+/***********************************************
+ * POP COUNT
+ * How many squares are in the set?
+ **********************************************/
+inline int popCount(Bitboard bb)
+{
+#if defined(__GNUC__) || defined(__clang__)
+   return __builtin_popcountll(bb);
+#elif defined(_MSC_VER) && defined(_M_X64)
+   return (int)__popcnt64(bb);
+#else
+   int count = 0;
+   for (; bb; bb &= bb - 1)
+      count++;
+   return count;
+#endif
+}
+
+/***********************************************
+ * BIT SCAN
+ * The lowest location in a non-empty set
+ **********************************************/
+inline int bitScan(Bitboard bb)
+{
+   assert(bb != BB_EMPTY);
+#if defined(__GNUC__) || defined(__clang__)
+   return __builtin_ctzll(bb);
+#elif defined(_MSC_VER) && defined(_M_X64)
+   unsigned long index;
+   _BitScanForward64(&index, bb);
+   return (int)index;
+#else
+   int index = 0;
+   while (!(bb & 1ULL))
+   {
+      bb >>= 1;
+      index++;
+   }
+   return index;
+#endif
+}
+
+/***********************************************
+ * POP LSB
+ * Remove the lowest location from the set and return it
+ **********************************************/
+inline int popLsb(Bitboard& bb)
+{
+   int location = bitScan(bb);
+   bb &= bb - 1;
+   return location;
+}
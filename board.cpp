@@ -8,11 +8,21 @@
  ************************************************************************/
 
 #include "board.h"
+#include "perftTable.h"
+#include "slider.h"
+#include "leaper.h"
 #include "uiDraw.h"
 #include "position.h"
 #include "piece.h"
+#include "pieceKing.h"
+#include "pieceQueen.h"
+#include "pieceRook.h"
+#include "pieceBishop.h"
 #include "pieceKnight.h"
+#include "piecePawn.h"
 #include <cassert>
+#include <charconv>
+#include <algorithm>
 using namespace std;
 
 /***********************************************
@@ -34,23 +44,424 @@ using namespace std;
 void Board::reset(bool fFree)
 {
    // free everything
-   for (int r = 0; r < 8; r++)
-      for (int c = 0; c < 8; c++)
-         board[c][r] = nullptr;
+   if (fFree)
+      free();
+   clearSquares();
 
    // Add white knights at b8 (1,7) and g8 (6,7)
-   board[1][7] = new Knight(1, 7, true);
-   board[6][7] = new Knight(6, 7, true);
+   addPiece(57, pieceCode(KNIGHT, true));
+   addPiece(62, pieceCode(KNIGHT, true));
 
    // Add black knights at b1 (1,0) and g1 (6,0)
-   board[1][0] = new Knight(1, 0, false);
-   board[6][0] = new Knight(6, 0, false);
+   addPiece(1, pieceCode(KNIGHT, false));
+   addPiece(6, pieceCode(KNIGHT, false));
 
-   // Fill empty spaces with Space objects
-   for (int r = 0; r < 8; r++)
-      for (int c = 0; c < 8; c++)
-         if (board[c][r] == nullptr)
-            board[c][r] = new Space(c, r);
+   // Give the UI and the tests a Piece to look at on every square
+   buildViews();
+
+   // Stock up on spaces so captures never need to allocate one
+   while (numSpare < MAX_SPARE)
+      spare[numSpare++] = new Space(0, 0);
+
+   // A fresh game
+   numMoves  = 0;
+   halfMoves = 0;
+   enPassant = -1;
+   resetCastle();
+   hash = computeHash();
+   if (fAttackMaps)
+      updateAttackMaps();
+}
+
+
+/***********************************************
+ * BOARD : RESET CASTLE
+ *         A castle is possible when the king and
+ *         rook are still on their starting squares
+ ***********************************************/
+void Board::resetCastle()
+{
+   castle = CASTLE_NONE;
+   if (squares[4] == pieceCode(KING, true))
+   {
+      if (squares[7] == pieceCode(ROOK, true))
+         castle |= CASTLE_WHITE_KING;
+      if (squares[0] == pieceCode(ROOK, true))
+         castle |= CASTLE_WHITE_QUEEN;
+   }
+   if (squares[60] == pieceCode(KING, false))
+   {
+      if (squares[63] == pieceCode(ROOK, false))
+         castle |= CASTLE_BLACK_KING;
+      if (squares[56] == pieceCode(ROOK, false))
+         castle |= CASTLE_BLACK_QUEEN;
+   }
+}
+
+
+/***********************************************
+ * FEN LETTER
+ *         The letter FEN uses for a piece: capitals
+ *         for white, small letters for black
+ ***********************************************/
+static char fenLetter(PieceCode code)
+{
+   static const char letters[8] = { '?', ' ', 'k', 'q', 'r', 'b', 'n', 'p' };
+   char letter = letters[codeType(code)];
+   return codeWhite(code) ? (char)(letter - 'a' + 'A') : letter;
+}
+
+
+/***********************************************
+ * FEN PIECE
+ *         The piece code for a FEN letter, SPACE if
+ *         the letter is not a piece
+ ***********************************************/
+static PieceCode fenPiece(char letter)
+{
+   bool fWhite = (letter >= 'A' && letter <= 'Z');
+   switch (fWhite ? letter - 'A' + 'a' : letter)
+   {
+      case 'k': return pieceCode(KING,   fWhite);
+      case 'q': return pieceCode(QUEEN,  fWhite);
+      case 'r': return pieceCode(ROOK,   fWhite);
+      case 'b': return pieceCode(BISHOP, fWhite);
+      case 'n': return pieceCode(KNIGHT, fWhite);
+      case 'p': return pieceCode(PAWN,   fWhite);
+      default:  return SPACE;
+   }
+}
+
+
+/***********************************************
+ * NEXT FIELD
+ *         Peel the next space-separated field off
+ *         the front of a FEN, empty when none is left
+ ***********************************************/
+static string_view nextField(string_view& fen)
+{
+   size_t begin = fen.find_first_not_of(' ');
+   if (begin == string_view::npos)
+   {
+      fen = string_view();
+      return fen;
+   }
+   fen.remove_prefix(begin);
+   size_t end = min(fen.find(' '), fen.size());
+   string_view field = fen.substr(0, end);
+   fen.remove_prefix(end);
+   return field;
+}
+
+
+/***********************************************
+ * READ COUNT
+ *         One of the move counters, which must be
+ *         nothing but digits. An absent one is left
+ *         as it is
+ ***********************************************/
+static bool readCount(string_view field, int& count)
+{
+   if (field.empty())
+      return true;
+   const char* end = field.data() + field.size();
+   from_chars_result result = from_chars(field.data(), end, count);
+   return result.ec == errc() && result.ptr == end;
+}
+
+
+/***********************************************
+ * BOARD : SET FEN
+ *         Set up the position a FEN describes, such as
+ *         "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1".
+ *         The two move counters may be left off. Everything
+ *         is checked before the board is touched, so a bad
+ *         FEN returns false and leaves the board as it was.
+ *         The views the board already has are moved to
+ *         their new squares, so nothing is allocated unless
+ *         the position has more of some piece than the
+ *         board ever held, such as a third queen.
+ *   INPUT  fen  the position
+ *   OUTPUT      whether it was a well-formed FEN
+ ***********************************************/
+bool Board::setFEN(string_view fen)
+{
+   // The pieces, from a8 across and down to h1
+   PieceCode codes[64];
+   for (PieceCode& code : codes)
+      code = SPACE;
+   string_view field = nextField(fen);
+   int row = 7;
+   int col = 0;
+   int numKings[2] = { 0, 0 };
+   for (char ch : field)
+   {
+      if (ch == '/')
+      {
+         if (col != 8 || row == 0)
+            return false;
+         row--;
+         col = 0;
+      }
+      else if (ch >= '1' && ch <= '8')
+      {
+         col += ch - '0';
+         if (col > 8)
+            return false;
+      }
+      else
+      {
+         PieceCode code = fenPiece(ch);
+         if (code == SPACE || col >= 8)
+            return false;
+         if (codeType(code) == PAWN && (row == 0 || row == 7))
+            return false;
+         if (codeType(code) == KING)
+            numKings[colorFrom(codeWhite(code))]++;
+         codes[row * 8 + col++] = code;
+      }
+   }
+   if (row != 0 || col != 8 || numKings[WHITE] != 1 || numKings[BLACK] != 1)
+      return false;
+
+   // Whose turn it is
+   field = nextField(fen);
+   if (field != "w" && field != "b")
+      return false;
+   bool fWhite = (field == "w");
+
+   // Castle rights
+   uint8_t rights = CASTLE_NONE;
+   field = nextField(fen);
+   if (field.empty())
+      return false;
+   if (field != "-")
+      for (char ch : field)
+         switch (ch)
+         {
+            case 'K': rights |= CASTLE_WHITE_KING;  break;
+            case 'Q': rights |= CASTLE_WHITE_QUEEN; break;
+            case 'k': rights |= CASTLE_BLACK_KING;  break;
+            case 'q': rights |= CASTLE_BLACK_QUEEN; break;
+            default:  return false;
+         }
+
+   // The square behind a pawn that just moved two: on the sixth rank
+   // if white is to move, the third if black is, and empty, with the
+   // other side's pawn just beyond it
+   int square = -1;
+   field = nextField(fen);
+   if (field.empty())
+      return false;
+   if (field != "-")
+   {
+      if (field.size() != 2 || field[0] < 'a' || field[0] > 'h' ||
+          field[1] != (fWhite ? '6' : '3'))
+         return false;
+      square = (field[1] - '1') * 8 + (field[0] - 'a');
+      if (codes[square] != SPACE ||
+          codes[fWhite ? square - 8 : square + 8] != pieceCode(PAWN, !fWhite))
+         return false;
+   }
+
+   // The move counters, if they are there
+   int half = 0;
+   int full = 1;
+   if (!readCount(nextField(fen), half) || !readCount(nextField(fen), full))
+      return false;
+   if (half < 0 || full < 1)
+      return false;
+
+   // Everything checks out, so replace what is there
+   clearSquares();
+   while (!undo.empty())
+      undo.pop();
+   for (int location = 0; location < 64; location++)
+      if (codes[location] != SPACE)
+         addPiece(location, codes[location]);
+   numMoves  = (full - 1) * 2 + (fWhite ? 0 : 1);
+   halfMoves = half;
+   enPassant = square;
+   resetCastle();             // what the kings and rooks still allow,
+   castle &= rights;          // of what the FEN claims
+   hash = computeHash();
+   if (fAttackMaps)
+      updateAttackMaps();
+
+   if (board[0][0] != nullptr)
+      reuseViews();
+   return true;
+}
+
+
+/***********************************************
+ * BOARD : GET FEN
+ *         Write the position out as a FEN. The buffer
+ *         must hold at least FEN_MAX characters
+ *   OUTPUT buf  the FEN, null-terminated
+ *          the length of the FEN
+ ***********************************************/
+int Board::getFEN(char* buf) const
+{
+   char* p = buf;
+
+   // The pieces, from a8 across and down to h1
+   for (int row = 7; row >= 0; row--)
+   {
+      int numSpaces = 0;
+      for (int col = 0; col < 8; col++)
+      {
+         PieceCode code = squares[row * 8 + col];
+         if (code == SPACE)
+            numSpaces++;
+         else
+         {
+            if (numSpaces)
+               *p++ = (char)('0' + numSpaces);
+            numSpaces = 0;
+            *p++ = fenLetter(code);
+         }
+      }
+      if (numSpaces)
+         *p++ = (char)('0' + numSpaces);
+      if (row > 0)
+         *p++ = '/';
+   }
+
+   // Whose turn it is and the castle rights
+   *p++ = ' ';
+   *p++ = whiteTurn() ? 'w' : 'b';
+   *p++ = ' ';
+   if (castle == CASTLE_NONE)
+      *p++ = '-';
+   if (castle & CASTLE_WHITE_KING)  *p++ = 'K';
+   if (castle & CASTLE_WHITE_QUEEN) *p++ = 'Q';
+   if (castle & CASTLE_BLACK_KING)  *p++ = 'k';
+   if (castle & CASTLE_BLACK_QUEEN) *p++ = 'q';
+
+   // En passant
+   *p++ = ' ';
+   if (enPassant < 0)
+      *p++ = '-';
+   else
+   {
+      *p++ = (char)('a' + enPassant % 8);
+      *p++ = (char)('1' + enPassant / 8);
+   }
+
+   // The move counters
+   char* end = buf + FEN_MAX - 1;
+   *p++ = ' ';
+   p = to_chars(p, end, halfMoves).ptr;
+   *p++ = ' ';
+   p = to_chars(p, end, numMoves / 2 + 1).ptr;
+   *p = '\0';
+   return (int)(p - buf);
+}
+
+
+/***********************************************
+ * NEW VIEW
+ *         Make the Piece object for one piece code
+ ***********************************************/
+static Piece* newView(PieceCode code, int c, int r)
+{
+   bool fWhite = codeWhite(code);
+   switch (codeType(code))
+   {
+      case KING:   return new King  (c, r, fWhite);
+      case QUEEN:  return new Queen (c, r, fWhite);
+      case ROOK:   return new Rook  (c, r, fWhite);
+      case BISHOP: return new Bishop(c, r, fWhite);
+      case KNIGHT: return new Knight(c, r, fWhite);
+      case PAWN:   return new Pawn  (c, r, fWhite);
+      default:     return new Space (c, r);
+   }
+}
+
+
+/***********************************************
+ * BOARD : BUILD VIEWS
+ *         Make a Piece object for every square from
+ *         the piece codes. The views are only for the
+ *         UI and the tests; nothing in move generation
+ *         or makeMove() looks at them.
+ ***********************************************/
+void Board::buildViews()
+{
+   for (int location = 0; location < 64; location++)
+      board[location % 8][location / 8] =
+         newView(squares[location], location % 8, location / 8);
+}
+
+
+/***********************************************
+ * TAKE VIEW
+ *         Pull a view of one kind out of a pool,
+ *         nullptr if there is none
+ ***********************************************/
+static Piece* takeView(std::vector<Piece*>& pool, PieceCode code)
+{
+   PieceType pt = codeType(code);
+   bool fWhite = codeWhite(code);
+   for (size_t i = 0; i < pool.size(); i++)
+      if (pool[i]->getType() == pt && (pt == SPACE || pool[i]->isWhite() == fWhite))
+      {
+         Piece* piece = pool[i];
+         pool[i] = pool.back();
+         pool.pop_back();
+         return piece;
+      }
+   return nullptr;
+}
+
+
+/***********************************************
+ * BOARD : REUSE VIEWS
+ *         Match the views to new piece codes without
+ *         starting over: a view already of the right
+ *         kind stays on its square, the rest go into
+ *         the captured list, and the empty squares are
+ *         filled from it. Only a kind the board has no
+ *         view for is allocated.
+ ***********************************************/
+void Board::reuseViews()
+{
+   // Everything not already right comes off the board
+   while (numSpare > 0)
+      captured.push_back(spare[--numSpare]);
+   for (int location = 0; location < 64; location++)
+   {
+      Piece*& pView = board[location % 8][location / 8];
+      PieceCode code = squares[location];
+      PieceType pt = codeType(code);
+      if (pView->getType() != pt || (pt != SPACE && pView->isWhite() != codeWhite(code)))
+      {
+         captured.push_back(pView);
+         pView = nullptr;
+      }
+   }
+
+   // Then every square gets one, fresh as if just made
+   for (int location = 0; location < 64; location++)
+   {
+      Piece*& pView = board[location % 8][location / 8];
+      if (pView == nullptr)
+      {
+         pView = takeView(captured, squares[location]);
+         if (pView == nullptr)
+            pView = newView(squares[location], location % 8, location / 8);
+      }
+      pView->setPosition(Position(location));
+      pView->clearMoves();
+   }
+
+   // and the spaces left over are spares again
+   while (numSpare < MAX_SPARE)
+   {
+      Piece* pSpace = takeView(captured, SPACE);
+      spare[numSpare++] = (pSpace != nullptr) ? pSpace : new Space(0, 0);
+   }
 }
 
 
@@ -70,6 +481,487 @@ Piece& Board::operator [] (const Position& pos)
    return *p;
 }
 
+/***********************************************
+* SIDE
+*         Everything about a color that move generation
+*         needs, worked out by the compiler so the
+*         generators below never test fWhite
+***********************************************/
+template <Color C>
+struct Side
+{
+   static const bool     WHITE_TO_MOVE = (C == WHITE);
+   static const Color    THEM       = WHITE_TO_MOVE ? BLACK : WHITE;
+   static const int      UP         = WHITE_TO_MOVE ? 8 : -8;   // one rank forward
+   static const Bitboard RANK_THIRD = WHITE_TO_MOVE ? BB_RANK_1 << 16 : BB_RANK_8 >> 16;
+   static const Bitboard RANK_LAST  = WHITE_TO_MOVE ? BB_RANK_8 : BB_RANK_1;
+   static const int      HOME       = WHITE_TO_MOVE ? 4 : 60;   // e1 or e8
+   static const int      KING_SIDE  = WHITE_TO_MOVE ? CASTLE_WHITE_KING  : CASTLE_BLACK_KING;
+   static const int      QUEEN_SIDE = WHITE_TO_MOVE ? CASTLE_WHITE_QUEEN : CASTLE_BLACK_QUEEN;
+};
+
+/***********************************************
+* SHIFT
+*         Move a whole set some squares up (positive)
+*         or down (negative) the board. Both shift
+*         counts stay non-negative so the branch that
+*         is never taken still compiles cleanly
+***********************************************/
+template <int DELTA>
+inline Bitboard shift(Bitboard bb)
+{
+   return DELTA > 0 ? bb << (DELTA > 0 ? DELTA : 0) : bb >> (DELTA < 0 ? -DELTA : 0);
+}
+
+/***********************************************
+* ATTACKS FROM
+*         The squares a piece other than a pawn
+*         attacks from a location
+***********************************************/
+template <PieceType PT> Bitboard attacksFrom(int location, Bitboard occupied);
+template <> inline Bitboard attacksFrom<KING>  (int location, Bitboard)          { return kingAttacks(location);             }
+template <> inline Bitboard attacksFrom<QUEEN> (int location, Bitboard occupied) { return queenAttacks(location, occupied);   }
+template <> inline Bitboard attacksFrom<ROOK>  (int location, Bitboard occupied) { return rookAttacks(location, occupied);    }
+template <> inline Bitboard attacksFrom<BISHOP>(int location, Bitboard occupied) { return bishopAttacks(location, occupied);  }
+template <> inline Bitboard attacksFrom<KNIGHT>(int location, Bitboard)          { return knightAttacks(location);           }
+
+/***********************************************
+* BOARD : GENERATE
+*         The moves of the pieces of one color and type
+*         standing on the from squares: onto an enemy
+*         piece, onto an empty square, or both
+***********************************************/
+template <Color C, PieceType PT>
+void Board::generate(MoveList& moves, GenType type, Bitboard from) const
+{
+   Bitboard occupied = bbOccupied;
+   Bitboard targets  = (type == GEN_CAPTURES) ? bbColors[Side<C>::THEM] :
+                       (type == GEN_QUIETS)   ? ~occupied :
+                                                ~bbColors[C];
+   for (Bitboard bb = bbColors[C] & bbPieces[PT] & from; bb; )
+   {
+      int src = popLsb(bb);
+      for (Bitboard dests = attacksFrom<PT>(src, occupied) & targets; dests; )
+      {
+         int dest = popLsb(dests);
+         moves.push_back(MoveCode(src, dest, (occupied & squareBit(dest)) ?
+                                              MoveCode::CAPTURE : MoveCode::QUIET));
+      }
+   }
+}
+
+/***********************************************
+* ADD PAWN MOVES
+*         One move for each destination in a set, all
+*         made by pawns DELTA squares behind. Moves onto
+*         the last rank become four, one per promotion
+*         piece, queen first since it is nearly always best
+***********************************************/
+template <int DELTA>
+inline void addPawnMoves(MoveList& moves, Bitboard dests, Bitboard lastRank, int flags)
+{
+   for (Bitboard bb = dests & ~lastRank; bb; )
+   {
+      int dest = popLsb(bb);
+      moves.push_back(MoveCode(dest - DELTA, dest, flags));
+   }
+   for (Bitboard bb = dests & lastRank; bb; )
+   {
+      int dest = popLsb(bb);
+      moves.push_back(MoveCode(dest - DELTA, dest, flags | MoveCode::promoteFlag(QUEEN)));
+      moves.push_back(MoveCode(dest - DELTA, dest, flags | MoveCode::promoteFlag(ROOK)));
+      moves.push_back(MoveCode(dest - DELTA, dest, flags | MoveCode::promoteFlag(BISHOP)));
+      moves.push_back(MoveCode(dest - DELTA, dest, flags | MoveCode::promoteFlag(KNIGHT)));
+   }
+}
+
+/***********************************************
+* BOARD : GENERATE PAWNS
+*         The pawns all move at once as a set: push
+*         one rank, push again from the third rank,
+*         and take toward either side. Each move is
+*         then read back off the destination square.
+*         Promotions count with the captures, quiet
+*         or not, since they change the material too
+***********************************************/
+template <Color C>
+void Board::generatePawns(MoveList& moves, GenType type, Bitboard from) const
+{
+   const int UP = Side<C>::UP;
+   const Bitboard LAST = Side<C>::RANK_LAST;
+   Bitboard pawns  = bbColors[C] & bbPieces[PAWN] & from;
+   Bitboard empty  = ~bbOccupied;
+   Bitboard single = shift<UP>(pawns) & empty;
+
+   if (type != GEN_CAPTURES)
+   {
+      Bitboard twice = shift<UP>(single & Side<C>::RANK_THIRD) & empty;
+      addPawnMoves<UP>    (moves, single & ~LAST, LAST, MoveCode::QUIET);
+      addPawnMoves<2 * UP>(moves, twice,          LAST, MoveCode::QUIET);
+   }
+
+   if (type != GEN_QUIETS)
+   {
+      // toward the a-file is one less than a rank, toward the h-file one more
+      Bitboard theirs = bbColors[Side<C>::THEM];
+      addPawnMoves<UP>    (moves, single & LAST, LAST, MoveCode::QUIET);
+      addPawnMoves<UP - 1>(moves, shift<UP - 1>(pawns & ~BB_FILE_A) & theirs,
+                           LAST, MoveCode::CAPTURE);
+      addPawnMoves<UP + 1>(moves, shift<UP + 1>(pawns & ~BB_FILE_H) & theirs,
+                           LAST, MoveCode::CAPTURE);
+
+      // our pawns that could take on the en-passant square are the
+      // squares an enemy pawn standing there would attack
+      if (enPassant >= 0)
+         for (Bitboard bb = pawnAttacks(!Side<C>::WHITE_TO_MOVE, enPassant) & pawns; bb; )
+            moves.push_back(MoveCode(popLsb(bb), enPassant, MoveCode::ENPASSANT));
+   }
+}
+
+/***********************************************
+* BOARD : GENERATE PAWN MOVES
+*         Every move of one side's pawns on the from
+*         squares, for the Pawn pieces to hand on
+***********************************************/
+void Board::generatePawnMoves(MoveList& moves, bool fWhite, Bitboard from) const
+{
+   if (fWhite)
+      generatePawns<WHITE>(moves, GEN_ALL, from);
+   else
+      generatePawns<BLACK>(moves, GEN_ALL, from);
+}
+
+/***********************************************
+* BOARD : GENERATE CASTLES
+*         When the rights are still there, the squares
+*         between king and rook are empty, and the king
+*         neither starts, crosses nor lands on an
+*         attacked square
+***********************************************/
+template <Color C>
+void Board::generateCastles(MoveList& moves) const
+{
+   const int HOME = Side<C>::HOME;
+   const bool fThem = !Side<C>::WHITE_TO_MOVE;
+   Bitboard empty = ~bbOccupied;
+
+   if (!(castle & (Side<C>::KING_SIDE | Side<C>::QUEEN_SIDE)) ||
+       isSquareAttacked(HOME, fThem))
+      return;
+   if ((castle & Side<C>::KING_SIDE) &&
+       (empty & squareBit(HOME + 1)) && (empty & squareBit(HOME + 2)) &&
+       !isSquareAttacked(HOME + 1, fThem) && !isSquareAttacked(HOME + 2, fThem))
+      moves.push_back(MoveCode(HOME, HOME + 2, MoveCode::CASTLE_KING));
+   if ((castle & Side<C>::QUEEN_SIDE) &&
+       (empty & squareBit(HOME - 1)) && (empty & squareBit(HOME - 2)) &&
+       (empty & squareBit(HOME - 3)) &&
+       !isSquareAttacked(HOME - 1, fThem) && !isSquareAttacked(HOME - 2, fThem))
+      moves.push_back(MoveCode(HOME, HOME - 2, MoveCode::CASTLE_QUEEN));
+}
+
+/***********************************************
+* BOARD : GENERATE SIDE
+*         Every piece type of one color, pawns first
+***********************************************/
+template <Color C>
+void Board::generateSide(MoveList& moves, GenType type, Bitboard from) const
+{
+   generatePawns<C>(moves, type, from);
+   generate<C, KNIGHT>(moves, type, from);
+   generate<C, BISHOP>(moves, type, from);
+   generate<C, ROOK>  (moves, type, from);
+   generate<C, QUEEN> (moves, type, from);
+   generate<C, KING>  (moves, type, from);
+   if (type != GEN_CAPTURES && (from & squareBit(Side<C>::HOME)))
+      generateCastles<C>(moves);
+}
+
+/***********************************************
+* BOARD : GENERATE
+*         Pick the color once, then everything below
+*         is compiled for that color alone
+***********************************************/
+void Board::generate(MoveList& moves, GenType type, Bitboard from) const
+{
+   if (whiteTurn())
+      generateSide<WHITE>(moves, type, from);
+   else
+      generateSide<BLACK>(moves, type, from);
+}
+
+/***********************************************
+* BOARD : GENERATE MOVES
+*         Every move of the side to move, ignoring check
+***********************************************/
+void Board::generateMoves(MoveList& moves) const
+{
+   generate(moves, GEN_ALL, BB_FULL);
+}
+
+void Board::generateCaptures(MoveList& moves) const
+{
+   generate(moves, GEN_CAPTURES, BB_FULL);
+}
+
+void Board::generateQuiets(MoveList& moves) const
+{
+   generate(moves, GEN_QUIETS, BB_FULL);
+}
+
+/***********************************************
+* BOARD : IS PSEUDO LEGAL
+*         Could the side to move play this move here,
+*         ignoring check? For a move remembered from
+*         another position, such as a hash or killer
+*         move, so only its own piece is asked
+***********************************************/
+bool Board::isPseudoLegal(MoveCode move) const
+{
+   int src = move.getSrc();
+   if (move == MOVE_NONE || !(bbColors[colorFrom(whiteTurn())] & squareBit(src)))
+      return false;
+
+   MoveList moves;
+   generate(moves, move.isCapture() || move.isPromotion() ? GEN_CAPTURES : GEN_QUIETS,
+            squareBit(src));
+   return moves.contains(move);
+}
+
+/***********************************************
+* BOARD : GENERATE LEGAL MOVES
+*         Every move that does not leave our own king
+*         in check. The checkers and the pinned pieces
+*         are found once, then each move is kept or
+*         dropped by looking at a mask:
+*           - in double check only the king may move
+*           - in check anything else must capture the
+*             checker or step between it and the king
+*           - a pinned piece must stay on its pin line
+*           - the king may not step onto an attacked
+*             square (the King already refuses to castle
+*             through one)
+*         En passant takes two pieces off one rank, so
+*         that alone is checked the slow way
+***********************************************/
+void Board::generateLegalMoves(MoveList& moves) const
+{
+   bool fWhite = whiteTurn();
+   Bitboard mine   = bbColors[colorFrom(fWhite)];
+   Bitboard theirs = bbColors[colorFrom(!fWhite)];
+   Bitboard kings  = bbPieces[KING] & mine;
+
+   // with no king there is nothing to leave in check
+   if (!kings)
+   {
+      generateMoves(moves);
+      return;
+   }
+   int king = bitScan(kings);
+   Bitboard occupied = bbOccupied;
+   Bitboard queens   = bbPieces[QUEEN];
+
+   // who is giving check, and where a blocker or capture must go
+   Bitboard checkers = attackersTo(king, occupied) & theirs;
+   bool fDouble = (checkers & (checkers - 1)) != BB_EMPTY;
+   Bitboard evasion = BB_FULL;
+   if (checkers)
+      evasion = fDouble ? BB_EMPTY : checkers | BETWEEN[king][bitScan(checkers)];
+
+   // our pieces standing alone between an enemy slider and our king
+   Bitboard pinned  = BB_EMPTY;
+   Bitboard snipers = theirs &
+      ((rookAttacks  (king, BB_EMPTY) & (bbPieces[ROOK]   | queens)) |
+       (bishopAttacks(king, BB_EMPTY) & (bbPieces[BISHOP] | queens)));
+   while (snipers)
+   {
+      Bitboard between = BETWEEN[king][popLsb(snipers)] & occupied;
+      if (between && !(between & (between - 1)) && (between & mine))
+         pinned |= between;
+   }
+
+   // the pseudo-legal moves, only the king's when in double check
+   MoveList pseudo;
+   generate(pseudo, GEN_ALL, fDouble ? kings : BB_FULL);
+
+   for (MoveCode move : pseudo)
+   {
+      int src  = move.getSrc();
+      int dest = move.getDest();
+      if (src == king)
+      {
+         // the king itself does not block the squares behind it
+         if (!move.isCastle() &&
+             (attackersTo(dest, occupied ^ squareBit(king)) & theirs))
+            continue;
+      }
+      else if (move.isEnPassant())
+      {
+         int captured = (src / 8) * 8 + dest % 8;
+         Bitboard after = (occupied ^ squareBit(src) ^ squareBit(captured)) |
+                          squareBit(dest);
+         if (attackersTo(king, after) & theirs & ~squareBit(captured))
+            continue;
+      }
+      else if (!(squareBit(dest) & evasion) ||
+               ((pinned & squareBit(src)) && !(LINE[king][src] & squareBit(dest))))
+         continue;
+      moves.push_back(move);
+   }
+}
+
+/***********************************************
+* BOARD : ATTACKERS TO
+*         Every piece, of both colors, attacking a
+*         location, worked backwards from the location:
+*         a knight there would see our knights, and so on.
+*         The occupancy is passed in so a square can be
+*         asked about as if some piece were not there
+***********************************************/
+Bitboard Board::attackersTo(int location, Bitboard occupied) const
+{
+   Bitboard pawns  = bbPieces[PAWN];
+   Bitboard queens = bbPieces[QUEEN];
+   return (pawnAttacks(false, location) & pawns & bbColors[WHITE]) |
+          (pawnAttacks(true,  location) & pawns & bbColors[BLACK]) |
+          (knightAttacks(location)      & bbPieces[KNIGHT])        |
+          (kingAttacks(location)        & bbPieces[KING])          |
+          (rookAttacks  (location, occupied) & (bbPieces[ROOK]   | queens)) |
+          (bishopAttacks(location, occupied) & (bbPieces[BISHOP] | queens));
+}
+
+/***********************************************
+* BOARD : IS SQUARE ATTACKED
+*         Does a side attack a location? Put each kind
+*         of piece on the location and see whether it
+*         sees one of the attacker's own kind, cheapest
+*         first, stopping at the first one found
+***********************************************/
+bool Board::isSquareAttacked(int location, bool fWhite) const
+{
+   if (fAttackMaps)
+      return (bbAttacks[colorFrom(fWhite)] & squareBit(location)) != BB_EMPTY;
+
+   Bitboard attackers = bbColors[colorFrom(fWhite)];
+   if (pawnAttacks(!fWhite, location) & bbPieces[PAWN]   & attackers)
+      return true;
+   if (knightAttacks(location)        & bbPieces[KNIGHT] & attackers)
+      return true;
+   if (kingAttacks(location)          & bbPieces[KING]   & attackers)
+      return true;
+
+   Bitboard queens = bbPieces[QUEEN] & attackers;
+   Bitboard rooks   = (bbPieces[ROOK]   & attackers) | queens;
+   Bitboard bishops = (bbPieces[BISHOP] & attackers) | queens;
+   return (rooks   && (rookAttacks  (location, bbOccupied) & rooks)) ||
+          (bishops && (bishopAttacks(location, bbOccupied) & bishops));
+}
+
+/***********************************************
+* BOARD : GET ATTACKS
+*         Every square one side attacks, from scratch.
+*         The sliders and pawns go as whole sets; the
+*         knights and the king one table lookup each
+***********************************************/
+Bitboard Board::getAttacks(bool fWhite) const
+{
+   Bitboard pawns = bbColors[colorFrom(fWhite)] & bbPieces[PAWN];
+   Bitboard attacks = getSliderAttacks(fWhite);
+   if (fWhite)
+      attacks |= ((pawns << 7) & ~BB_FILE_H) | ((pawns << 9) & ~BB_FILE_A);
+   else
+      attacks |= ((pawns >> 9) & ~BB_FILE_H) | ((pawns >> 7) & ~BB_FILE_A);
+   for (Bitboard bb = bbColors[colorFrom(fWhite)] & bbPieces[KNIGHT]; bb; )
+      attacks |= knightAttacks(popLsb(bb));
+   for (Bitboard bb = bbColors[colorFrom(fWhite)] & bbPieces[KING]; bb; )
+      attacks |= kingAttacks(popLsb(bb));
+   return attacks;
+}
+
+/***********************************************
+* BOARD : KEEP ATTACK MAPS
+*         Turn the per-side attack maps on or off. While
+*         they are on, makeMove() and unmakeMove() bring
+*         them up to date from the squares the move
+*         touched, so any number of isSquareAttacked()
+*         questions at one position cost a single AND each
+***********************************************/
+void Board::keepAttackMaps(bool fKeep)
+{
+   fAttackMaps = fKeep;
+   if (fAttackMaps)
+      updateAttackMaps();
+}
+
+/***********************************************
+* BOARD : UPDATE ATTACK MAPS
+*         Only a piece standing on a touched square, or
+*         a slider that saw one, can attack differently
+*         than before, so only those are worked out again.
+*         A slider that saw a touched square still sees
+*         it afterwards, so the same squares bring the
+*         maps back when the move is taken back. With
+*         every square touched this builds them from
+*         scratch
+***********************************************/
+void Board::updateAttackMaps(Bitboard touched)
+{
+   Bitboard stale = bbOccupied & touched;
+   for (Bitboard bb = touched & ~bbOccupied; bb; )
+      bbAttacksFrom[popLsb(bb)] = BB_EMPTY;
+   Bitboard sliders = (bbPieces[QUEEN] | bbPieces[ROOK] | bbPieces[BISHOP]) & ~stale;
+   while (sliders)
+   {
+      int location = popLsb(sliders);
+      if (bbAttacksFrom[location] & touched)
+         stale |= squareBit(location);
+   }
+   while (stale)
+   {
+      int location = popLsb(stale);
+      bbAttacksFrom[location] = pieceAttacks(location);
+   }
+
+   bbAttacks[WHITE] = bbAttacks[BLACK] = BB_EMPTY;
+   for (Bitboard bb = bbColors[WHITE]; bb; )
+      bbAttacks[WHITE] |= bbAttacksFrom[popLsb(bb)];
+   for (Bitboard bb = bbColors[BLACK]; bb; )
+      bbAttacks[BLACK] |= bbAttacksFrom[popLsb(bb)];
+}
+
+/***********************************************
+* BOARD : PIECE ATTACKS
+*         The squares the piece on a location attacks
+***********************************************/
+Bitboard Board::pieceAttacks(int location) const
+{
+   PieceCode code = squares[location];
+   switch (codeType(code))
+   {
+      case KING:   return kingAttacks(location);
+      case QUEEN:  return queenAttacks(location, bbOccupied);
+      case ROOK:   return rookAttacks(location, bbOccupied);
+      case BISHOP: return bishopAttacks(location, bbOccupied);
+      case KNIGHT: return knightAttacks(location);
+      case PAWN:   return pawnAttacks(codeWhite(code), location);
+      default:     return BB_EMPTY;
+   }
+}
+
+/***********************************************
+* BOARD : GET SLIDER ATTACKS
+*         Every square one side's rooks, bishops and
+*         queens attack, from one set-wise fill rather
+*         than one lookup per piece
+***********************************************/
+Bitboard Board::getSliderAttacks(bool fWhite) const
+{
+   Bitboard mine   = bbColors[colorFrom(fWhite)];
+   Bitboard queens = bbPieces[QUEEN];
+   return sliderSetAttacks((bbPieces[ROOK]   | queens) & mine,
+                           (bbPieces[BISHOP] | queens) & mine,
+                           bbOccupied);
+}
+
 /***********************************************
 * BOARD : DISPLAY
 *         Display the board
@@ -83,15 +975,21 @@ void Board::display(const Position& posHover, const Position& posSelect) const
       pgout->drawHover(posHover);
       pgout->drawSelected(posSelect);
 
-      // Draw all the pieces on the board
-      for (int r = 0; r < 8; r++)
+      // Draw all the pieces on the board straight from the piece codes
+      for (Bitboard bb = bbOccupied; bb; )
       {
-         for (int c = 0; c < 8; c++)
+         int location = popLsb(bb);
+         Position pos(location % 8, location / 8);
+         bool black = !codeWhite(squares[location]);
+         switch (codeType(squares[location]))
          {
-            if (board[c][r] != nullptr && board[c][r]->getType() != SPACE)
-            {
-               board[c][r]->display(pgout);
-            }
+            case KING:   pgout->drawKing  (pos, black); break;
+            case QUEEN:  pgout->drawQueen (pos, black); break;
+            case ROOK:   pgout->drawRook  (pos, black); break;
+            case BISHOP: pgout->drawBishop(pos, black); break;
+            case KNIGHT: pgout->drawKnight(pos, black); break;
+            case PAWN:   pgout->drawPawn  (pos, black); break;
+            default:     break;
          }
       }
    }
@@ -102,12 +1000,22 @@ void Board::display(const Position& posHover, const Position& posSelect) const
  * BOARD : CONSTRUCT
  *         Free up all the allocated memory
  ************************************************/
-Board::Board(ogstream* pgout, bool noreset) : pgout(pgout), numMoves(0)
+Board::Board(ogstream* pgout, bool noreset) : pgout(pgout), numMoves(0),
+   halfMoves(0), enPassant(-1), castle(CASTLE_NONE), hash(0), numSpare(0),
+   fAttackMaps(false)
 {
    // Initialize everything to nullptr
    for (int r = 0; r < 8; r++)
       for (int c = 0; c < 8; c++)
          board[c][r] = nullptr;
+   clearSquares();
+   bbAttacks[WHITE] = bbAttacks[BLACK] = BB_EMPTY;
+
+   // Reserve the undo storage now so makeMove() does not have to
+   std::vector<Undo> storage;
+   storage.reserve(1024);
+   undo = std::stack<Undo, std::vector<Undo>>(std::move(storage));
+   captured.reserve(64 + MAX_SPARE);    // every view, for setFEN() to sort through
 
    // Only reset the board if asked
    if (!noreset)
@@ -128,19 +1036,141 @@ void Board::free()
             delete board[c][r];
             board[c][r] = nullptr;
          }
+   clearSquares();
+
+   // the spare spaces and everything captured along the way
+   while (numSpare > 0)
+      delete spare[--numSpare];
+   for (Piece* pCaptured : captured)
+      delete pCaptured;
+   captured.clear();
+   while (!undo.empty())
+      undo.pop();
+}
+
+
+/************************************************
+ * BOARD : CLEAR SQUARES
+ *         Empty out every square and every bitboard
+ ************************************************/
+void Board::clearSquares()
+{
+   for (int location = 0; location < 64; location++)
+      squares[location] = SPACE;
+   for (int pt = 0; pt < 8; pt++)
+      bbPieces[pt] = BB_EMPTY;
+   bbColors[WHITE] = bbColors[BLACK] = BB_EMPTY;
+   bbOccupied = BB_EMPTY;
+   material[WHITE] = material[BLACK] = 0;
+   hash = 0;
+}
+
+
+/************************************************
+ * BOARD : COMPUTE HASH
+ *         Work out the Zobrist key from scratch. makeMove()
+ *         keeps the key up to date one XOR at a time; this
+ *         is what that incremental key is checked against.
+ ************************************************/
+uint64_t Board::computeHash() const
+{
+   uint64_t key = 0;
+   for (Bitboard bb = bbOccupied; bb; )
+   {
+      int location = popLsb(bb);
+      key ^= ZOBRIST.piece[squares[location]][location];
+   }
+   if (numMoves % 2 == 1)
+      key ^= ZOBRIST.side;
+   key ^= ZOBRIST.castle[castle];
+   if (enPassant >= 0)
+      key ^= ZOBRIST.enPassant[enPassant % 8];
+   return key;
+}
+
+
+/************************************************
+ * BOARD : ADD PIECE
+ *         Put a piece on an empty square
+ ************************************************/
+void Board::addPiece(int location, PieceCode code)
+{
+   assert(squares[location] == SPACE);
+   Bitboard bb = squareBit(location);
+   squares[location] = code;
+   bbPieces[codeType(code)]              |= bb;
+   bbColors[colorFrom(codeWhite(code))] |= bb;
+   bbOccupied                           |= bb;
+   hash ^= ZOBRIST.piece[code][location];
+   if (codeType(code) != KING)
+      material[colorFrom(codeWhite(code))] += PIECE_VALUE[codeType(code)];
+}
+
+
+/************************************************
+ * BOARD : REMOVE PIECE
+ *         Take a piece off its square
+ ************************************************/
+void Board::removePiece(int location)
+{
+   PieceCode code = squares[location];
+   assert(code != SPACE);
+   Bitboard bb = ~squareBit(location);
+   squares[location] = SPACE;
+   bbPieces[codeType(code)]              &= bb;
+   bbColors[colorFrom(codeWhite(code))] &= bb;
+   bbOccupied                           &= bb;
+   hash ^= ZOBRIST.piece[code][location];
+   if (codeType(code) != KING)
+      material[colorFrom(codeWhite(code))] -= PIECE_VALUE[codeType(code)];
+}
+
+
+/************************************************
+ * BOARD : MOVE PIECE
+ *         Slide a piece onto an empty square
+ ************************************************/
+void Board::movePiece(int src, int dest)
+{
+   PieceCode code = squares[src];
+   assert(code != SPACE && squares[dest] == SPACE);
+   Bitboard bb = squareBit(src) | squareBit(dest);
+   squares[src]  = SPACE;
+   squares[dest] = code;
+   bbPieces[codeType(code)]              ^= bb;
+   bbColors[colorFrom(codeWhite(code))] ^= bb;
+   bbOccupied                           ^= bb;
+   hash ^= ZOBRIST.piece[code][src] ^ ZOBRIST.piece[code][dest];
 }
 
 
 /**********************************************
  * BOARD : ASSERT BOARD
- *         Verify the board is well-formed
+ *         Verify the board is well-formed: every piece
+ *         set agrees with the squares it covers, and the
+ *         material adds up. Only the pieces are visited
  *********************************************/
-void Board::assertBoard()
+void Board::assertBoard() const
 {
-   // Verify pointers are valid
-   for (int r = 0; r < 8; r++)
-      for (int c = 0; c < 8; c++)
-         assert(board[c][r] != nullptr);
+#ifndef NDEBUG
+   Bitboard all = BB_EMPTY;
+   for (int color = WHITE; color <= BLACK; color++)
+   {
+      int sum = 0;
+      for (int pt = KING; pt <= PAWN; pt++)
+      {
+         Bitboard bb = bbPieces[pt] & bbColors[color];
+         assert(!(all & bb));
+         all |= bb;
+         if (pt != KING)
+            sum += PIECE_VALUE[pt] * popCount(bb);
+         while (bb)
+            assert(squares[popLsb(bb)] == pieceCode((PieceType)pt, color == WHITE));
+      }
+      assert(sum == material[color]);
+   }
+   assert(all == bbOccupied);
+#endif // !NDEBUG
 }
 
 
@@ -151,41 +1181,348 @@ void Board::assertBoard()
  *********************************************/
 void Board::move(const Move& move)
 {
-   // Get source and destination positions
-   int srcCol = move.getSrc().getCol();
-   int srcRow = move.getSrc().getRow();
-   int destCol = move.getDest().getCol();
-   int destRow = move.getDest().getRow();
-
    // Check if positions are valid
    if (!move.getSrc().isValid() || !move.getDest().isValid())
       return;
 
-   // Get the piece at the source position
-   Piece* piece = board[srcCol][srcRow];
-
    // Check if there's actually a piece at the source
-   if (piece == nullptr || piece->getType() == SPACE)
+   int src = move.getSrc().getLocation();
+   if (squares[src] == SPACE)
+      return;
+
+   // Keep the views in step, then move the pieces themselves
+   MoveCode code = move.getCode();
+   moveViews(code);
+   makeMove(code);
+}
+
+
+/**********************************************
+ * CASTLE ROOK
+ *         Where the rook starts and ends for a castle,
+ *         given the king's move
+ *********************************************/
+static void castleRook(MoveCode move, int& rookSrc, int& rookDest)
+{
+   int dest = move.getDest();
+   if (move.getFlags() == MoveCode::CASTLE_KING)
+   {
+      rookSrc  = dest + 1;   // h1 to f1
+      rookDest = dest - 1;
+   }
+   else
+   {
+      rookSrc  = dest - 2;   // a1 to d1
+      rookDest = dest + 1;
+   }
+}
+
+
+/**********************************************
+ * EN PASSANT VICTIM
+ *         The pawn taken en passant sits beside the
+ *         capturing pawn, behind the square it moves to
+ *********************************************/
+static int enPassantVictim(MoveCode move)
+{
+   return (move.getSrc() / 8) * 8 + move.getDest() % 8;
+}
+
+/**********************************************
+ * TOUCHED BY
+ *         Every square a move empties or fills
+ *********************************************/
+static Bitboard touchedBy(MoveCode move)
+{
+   Bitboard touched = squareBit(move.getSrc()) | squareBit(move.getDest());
+   if (move.isEnPassant())
+      touched |= squareBit(enPassantVictim(move));
+   else if (move.isCastle())
+   {
+      int rookSrc, rookDest;
+      castleRook(move, rookSrc, rookDest);
+      touched |= squareBit(rookSrc) | squareBit(rookDest);
+   }
+   return touched;
+}
+
+
+/**********************************************
+ * BOARD : MOVE VIEWS
+ *         Move the Piece objects the UI and the tests
+ *         look at to match a move, special moves too:
+ *         the castling rook goes along with the king,
+ *         the pawn taken en passant comes off, and a
+ *         promoted pawn becomes its new piece.
+ *********************************************/
+void Board::moveViews(MoveCode move)
+{
+   int src  = move.getSrc();
+   int dest = move.getDest();
+   moveView(src, dest);
+
+   if (move.isEnPassant())
+      removeView(enPassantVictim(move));
+   else if (move.isCastle())
+   {
+      int rookSrc, rookDest;
+      castleRook(move, rookSrc, rookDest);
+      moveView(rookSrc, rookDest);
+   }
+   else if (move.isPromotion())
+   {
+      // the only view ever made after reset(); promotions are rare
+      Piece*& pDest = board[dest % 8][dest / 8];
+      if (pDest == nullptr)
+         return;
+      PieceCode code = pieceCode(move.getPromotion(), codeWhite(squares[src]));
+      captured.push_back(pDest);
+      pDest = newView(code, dest % 8, dest / 8);
+      pDest->setLastMove(numMoves);
+   }
+}
+
+
+/**********************************************
+ * BOARD : MOVE VIEW
+ *         Move one Piece object. Nothing is allocated
+ *         or deleted: a captured piece is kept in the
+ *         captured list and its square is refilled from
+ *         the spare spaces.
+ *********************************************/
+void Board::moveView(int src, int dest)
+{
+   Piece*& pSrc  = board[src  % 8][src  / 8];
+   Piece*& pDest = board[dest % 8][dest / 8];
+   Piece* piece = pSrc;
+   if (piece == nullptr)
       return;
 
+   // Either capture what is on the destination or swap places with the space
+   if (pDest != nullptr && pDest->getType() != SPACE)
+   {
+      captured.push_back(pDest);
+      pSrc = takeSpace(src);
+   }
+   else
+      pSrc = (pDest != nullptr) ? pDest : takeSpace(src);
+   pDest = piece;
+
+   // Both views now know where they stand
+   pSrc->setPosition(Position(src));
+   piece->setPosition(Position(dest));
+
    // Update the move counter of the piece
    piece->setLastMove(numMoves);
+}
+
 
-   // Clean up the destination piece if it exists and isn't a space
-   if (board[destCol][destRow] != nullptr &&
-      board[destCol][destRow]->getType() != SPACE)
+/**********************************************
+ * BOARD : REMOVE VIEW
+ *         Take the Piece object off a square that was
+ *         captured without being moved onto
+ *********************************************/
+void Board::removeView(int location)
+{
+   Piece*& pView = board[location % 8][location / 8];
+   if (pView == nullptr || pView->getType() == SPACE)
+      return;
+   captured.push_back(pView);
+   pView = takeSpace(location);
+   pView->setPosition(Position(location));
+}
+
+
+/**********************************************
+ * CASTLE KEEP
+ *         Which castle rights survive a piece moving
+ *         from or to a given location
+ *********************************************/
+static uint8_t castleKeep(int location)
+{
+   switch (location)
    {
-      delete board[destCol][destRow];
+      case  0: return CASTLE_ALL & ~CASTLE_WHITE_QUEEN;                       // a1
+      case  4: return CASTLE_ALL & ~(CASTLE_WHITE_KING | CASTLE_WHITE_QUEEN); // e1
+      case  7: return CASTLE_ALL & ~CASTLE_WHITE_KING;                        // h1
+      case 56: return CASTLE_ALL & ~CASTLE_BLACK_QUEEN;                       // a8
+      case 60: return CASTLE_ALL & ~(CASTLE_BLACK_KING | CASTLE_BLACK_QUEEN); // e8
+      case 63: return CASTLE_ALL & ~CASTLE_BLACK_KING;                        // h8
+      default: return CASTLE_ALL;
    }
+}
+
+
+/**********************************************
+ * BOARD : TAKE SPACE
+ *         Get a space to leave behind on a vacated square
+ *********************************************/
+Piece* Board::takeSpace(int location)
+{
+   if (numSpare > 0)
+      return spare[--numSpare];
+   return new Space(location % 8, location / 8);
+}
+
+
+/**********************************************
+ * BOARD : MAKE MOVE
+ *         Move a piece code, pushing an Undo so
+ *         unmakeMove() can put everything back.
+ *         A castle moves the rook too, en passant takes
+ *         the pawn beside, and a promotion swaps the pawn
+ *         for its new piece. Each is a handful of square
+ *         updates, so the hash, piece sets and material
+ *         stay in step without recomputing anything.
+ *   INPUT move The instructions of the move
+ *********************************************/
+void Board::makeMove(MoveCode move)
+{
+   int src  = move.getSrc();
+   int dest = move.getDest();
+   PieceCode code = squares[src];
+   PieceType pt = codeType(code);
+   assert(pt != SPACE);
+   int victim = move.isEnPassant() ? enPassantVictim(move) : dest;
 
-   // Move the piece to the destination
-   board[destCol][destRow] = piece;
+   // Remember what we can not work out again
+   Undo u;
+   u.move      = move;
+   u.enPassant = (int8_t)enPassant;
+   u.castle    = castle;
+   u.captured  = squares[victim];
+   u.halfMoves = halfMoves;
+   u.hash      = hash;
 
-   // Clear the source position by placing a Space there
-   board[srcCol][srcRow] = new Space(srcCol, srcRow);
+   // Capture whatever is taken, then move there
+   if (u.captured != SPACE)
+      removePiece(victim);
+   movePiece(src, dest);
 
-   // Increment move counter
+   // The special moves have one more piece to see to
+   if (move.isCastle())
+   {
+      int rookSrc, rookDest;
+      castleRook(move, rookSrc, rookDest);
+      movePiece(rookSrc, rookDest);
+   }
+   else if (move.isPromotion())
+   {
+      removePiece(dest);
+      addPiece(dest, pieceCode(move.getPromotion(), codeWhite(code)));
+   }
+
+   // The rest of the game state, hashing out the old and in the new
+   if (enPassant >= 0)
+      hash ^= ZOBRIST.enPassant[enPassant % 8];
+   hash ^= ZOBRIST.castle[castle];
+   halfMoves = (pt == PAWN || u.captured != SPACE) ? 0 : halfMoves + 1;
+   enPassant = (pt == PAWN && (dest - src == 16 || src - dest == 16)) ?
+               (src + dest) / 2 : -1;
+   castle &= castleKeep(src) & castleKeep(dest);
    numMoves++;
+   if (enPassant >= 0)
+      hash ^= ZOBRIST.enPassant[enPassant % 8];
+   hash ^= ZOBRIST.castle[castle];
+   hash ^= ZOBRIST.side;
+   assert(hash == computeHash());
+   assertBoard();
+   if (fAttackMaps)
+      updateAttackMaps(touchedBy(move));
+
+   undo.push(u);
+}
+
+
+/**********************************************
+ * BOARD : UNMAKE MOVE
+ *         Take back the last move made by makeMove(),
+ *         restoring the board exactly as it was
+ *********************************************/
+void Board::unmakeMove()
+{
+   assert(!undo.empty());
+   const Undo& u = undo.top();
+   int src  = u.move.getSrc();
+   int dest = u.move.getDest();
+
+   // Undo the special moves first, so only the mover is left to go back
+   if (u.move.isCastle())
+   {
+      int rookSrc, rookDest;
+      castleRook(u.move, rookSrc, rookDest);
+      movePiece(rookDest, rookSrc);
+   }
+   else if (u.move.isPromotion())
+   {
+      bool fWhite = codeWhite(squares[dest]);
+      removePiece(dest);
+      addPiece(dest, pieceCode(PAWN, fWhite));
+   }
+
+   // Put the piece back where it came from, and the captured piece too
+   movePiece(dest, src);
+   if (u.captured != SPACE)
+      addPiece(u.move.isEnPassant() ? enPassantVictim(u.move) : dest, u.captured);
+
+   // The rest of the game state
+   numMoves--;
+   halfMoves = u.halfMoves;
+   enPassant = u.enPassant;
+   castle    = u.castle;
+   hash      = u.hash;
+   assert(hash == computeHash());
+   assertBoard();
+   if (fAttackMaps)
+      updateAttackMaps(touchedBy(u.move));
+
+   undo.pop();
+}
+
+
+/**********************************************
+ * BOARD : PERFT
+ *         Count the leaves of the legal move tree
+ *         down to a given depth. The counts for well
+ *         known positions are published, so this is
+ *         how move generation is checked and timed.
+ *         Two shortcuts give the same count faster:
+ *           - fBulk: one ply from the end, the number
+ *             of legal moves is the number of leaves,
+ *             so they are not made
+ *           - table: a position reached again by a
+ *             different move order is looked up, not
+ *             counted again
+ *   INPUT  depth  how many plies to look ahead
+ *          fBulk  count the last ply without making it
+ *          table  where counts are remembered, or nullptr
+ *   OUTPUT        the number of positions at that depth
+ *********************************************/
+uint64_t Board::perft(int depth, bool fBulk, PerftTable* table)
+{
+   if (depth <= 0)
+      return 1;
+
+   // Only worth remembering when there is more than one ply below
+   uint64_t nodes = 0;
+   if (table != nullptr && depth >= 2 && table->probe(hash, depth, nodes))
+      return nodes;
+
+   MoveList moves;
+   generateLegalMoves(moves);
+   if (fBulk && depth == 1)
+      return moves.size();
+
+   for (MoveCode move : moves)
+   {
+      makeMove(move);
+      nodes += perft(depth - 1, fBulk, table);
+      unmakeMove();
+   }
+
+   if (table != nullptr && depth >= 2)
+      table->store(hash, depth, nodes);
+   return nodes;
 }
 
 /**********************************************
@@ -202,3 +1539,20 @@ BoardEmpty::~BoardEmpty()
 {
    delete pSpace;
 }
+
+/**********************************************
+ * BOARD EMPTY : PLACE PIECES
+ * The tests fill the array directly, so add each
+ * piece found there to the squares and bitboards
+ * the same way a real board gets its pieces
+ *********************************************/
+void BoardEmpty::placePieces()
+{
+   clearSquares();
+   for (int location = 0; location < 64; location++)
+   {
+      const Piece* p = board[location % 8][location / 8];
+      if (p && p->getType() != SPACE)
+         addPiece(location, pieceCode(p->getType(), p->isWhite()));
+   }
+}
@@ -10,9 +10,14 @@
 #pragma once
 
 #include <stack>
+#include <string_view>
+#include <vector>
 #include <cassert>
 #include "move.h"   // Because we return a set of Move
+#include "moveList.h"
 #include "pieceSpace.h"
+#include "bitboard.h"
+#include "zobrist.h"
 
 class ogstream;
 class TestPawn;
@@ -22,8 +27,58 @@ class TestRook;
 class TestQueen;
 class TestKing;
 class TestBoard;
+class TestMovePicker;
 class Position;
 class Piece;
+class PerftTable;
+
+/***************************************************
+ * FEN
+ * The standard starting position, and enough room
+ * for any position Board::getFEN() writes out
+ **************************************************/
+const char FEN_START[] = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+const int  FEN_MAX     = 128;
+
+/***************************************************
+ * CASTLE RIGHTS
+ * Which castles are still possible, one bit each
+ **************************************************/
+enum CastleRights
+{
+   CASTLE_NONE = 0x0,
+   CASTLE_WHITE_KING  = 0x1,
+   CASTLE_WHITE_QUEEN = 0x2,
+   CASTLE_BLACK_KING  = 0x4,
+   CASTLE_BLACK_QUEEN = 0x8,
+   CASTLE_ALL = 0xf
+};
+
+/***************************************************
+ * GEN TYPE
+ * Which moves a generator is asked for
+ **************************************************/
+enum GenType
+{
+   GEN_CAPTURES,   // captures, en passant and promotions
+   GEN_QUIETS,     // everything else, castling included
+   GEN_ALL
+};
+
+/***************************************************
+ * UNDO
+ * Everything makeMove() changes that can not be worked
+ * out again from the move itself. One per move made.
+ **************************************************/
+struct Undo
+{
+   MoveCode  move;        // what was played, special flags and all
+   int8_t    enPassant;   // en-passant square before the move, -1 for none
+   uint8_t   castle;      // castle rights before the move
+   PieceCode captured;    // what was taken, SPACE for nothing
+   int       halfMoves;   // fifty-move counter before the move
+   uint64_t  hash;        // Zobrist key before the move
+};
 
 
 /***************************************************
@@ -39,11 +94,16 @@ class Board
    friend TestQueen;
    friend TestKing;
    friend TestBoard;
+   friend TestMovePicker;
 public:
 
    // create and destroy the board
    Board(ogstream* pgout = nullptr, bool noreset = false);
-   virtual ~Board() {}
+   virtual ~Board() { free(); }
+
+   // the board owns its Piece objects, so it is never copied
+   Board(const Board&) = delete;
+   Board& operator=(const Board&) = delete;
 
    // getters
    virtual int  getCurrentMove() const { return numMoves; }
@@ -51,17 +111,126 @@ public:
    virtual void display(const Position& posHover, const Position& posSelect) const;
    virtual const Piece& operator [] (const Position& pos) const;
 
+   // bitboards : the pieces as sets of squares, kept in sync by makeMove()
+   Bitboard  getOccupied()              const { return bbOccupied;                  }
+   Bitboard  getPieces(bool fWhite)     const { return bbColors[colorFrom(fWhite)]; }
+   Bitboard  getPieces(PieceType pt)    const { return bbPieces[pt];                }
+   PieceType getPieceType(int location) const { return codeType(squares[location]); }
+   Bitboard getPieces(bool fWhite, PieceType pt) const
+   {
+      return bbColors[colorFrom(fWhite)] & bbPieces[pt];
+   }
+
+   // what one side's pieces are worth, kings left out, kept up to date
+   // as pieces come and go so evaluation never has to count them
+   int getMaterial(bool fWhite) const { return material[colorFrom(fWhite)]; }
+   Bitboard getSliderAttacks(bool fWhite) const;
+
+   // every move of the side to move, and only those that do not
+   // leave its own king in check
+   void generateMoves(MoveList& moves) const;
+   void generateLegalMoves(MoveList& moves) const;
+
+   // the same moves split in two, so a search can ask for the
+   // captures first and only generate the rest if it needs them
+   void generateCaptures(MoveList& moves) const;
+   void generateQuiets(MoveList& moves) const;
+   void generate(MoveList& moves, GenType type, Bitboard from) const;
+   bool isPseudoLegal(MoveCode move) const;
+   void generatePawnMoves(MoveList& moves, bool fWhite, Bitboard from) const;
+
+   // every piece of either color attacking a location
+   Bitboard attackersTo(int location, Bitboard occupied) const;
+
+   // is a location attacked by one side? With the attack maps kept
+   // this is one AND, otherwise it is worked back from the location
+   bool isSquareAttacked(int location, bool fWhite) const;
+   Bitboard getAttacks(bool fWhite) const;
+   void keepAttackMaps(bool fKeep);
+
+   // game state beyond the pieces
+   int  getCastle()    const { return castle;    }
+   int  getEnPassant() const { return enPassant; }
+   int  getHalfMoves() const { return halfMoves; }
+
+   // Zobrist key of the position, updated by every move
+   uint64_t getHash() const { return hash; }
+   uint64_t computeHash() const;
+
    // setters
    virtual void free();
    virtual void reset(bool fFree = true);
+   bool setFEN(std::string_view fen);
+   int  getFEN(char* buf) const;
    virtual void move(const Move& move);
    virtual Piece& operator [] (const Position& pos);
 
+   // make and take back a move without allocating anything
+   void makeMove(MoveCode move);
+   void makeMove(const Move& move) { makeMove(move.getCode()); }
+   void unmakeMove();
+
+   // the number of positions depth plies ahead
+   uint64_t perft(int depth, bool fBulk = false, PerftTable* table = nullptr);
+
 protected:
-   void  assertBoard();
+   void  assertBoard() const;
+   void  clearSquares();
+   void  addPiece(int location, PieceCode code);
+   void  removePiece(int location);
+   void  movePiece(int src, int dest);
+   void  resetCastle();
+   void  buildViews();
+   void  reuseViews();
+   void  moveViews(MoveCode move);
+   void  moveView(int src, int dest);
+   void  removeView(int location);
+   void  updateAttackMaps(Bitboard touched = BB_FULL);
+   Bitboard pieceAttacks(int location) const;
+
+   // the generators, compiled once per color and piece type
+   template <Color C, PieceType PT>
+   void  generate(MoveList& moves, GenType type, Bitboard from) const;
+   template <Color C>
+   void  generatePawns(MoveList& moves, GenType type, Bitboard from) const;
+   template <Color C>
+   void  generateCastles(MoveList& moves) const;
+   template <Color C>
+   void  generateSide(MoveList& moves, GenType type, Bitboard from) const;
+   Piece* takeSpace(int location);
 
-   Piece* board[8][8];    // the board of chess pieces
+   // the pieces themselves: one byte per square, in one cache line
+   alignas(64) PieceCode squares[64];
+
+   // a Piece object per square so the UI and the tests have something to hold
+   Piece* board[8][8];
    int numMoves;
+   int halfMoves;         // moves since the last capture or pawn move
+   int enPassant;         // square a pawn can capture onto en passant, -1 for none
+   uint8_t castle;        // CastleRights still available
+   uint64_t hash;         // Zobrist key of everything above
+
+   // one Undo per move made; the storage is reserved up front
+   std::stack<Undo, std::vector<Undo>> undo;
+
+   // spaces put on the vacated square of a capture so move() never
+   // allocates, and the captured pieces it takes off the board
+   static const int MAX_SPARE = 32;
+   Piece* spare[MAX_SPARE];
+   int numSpare;
+   std::vector<Piece*> captured;
+
+   Bitboard bbPieces[8];  // one set per PieceType, both colors
+   Bitboard bbColors[2];  // one set per Color, all piece types
+   Bitboard bbOccupied;   // every square that is not a space
+   int material[2];       // one per Color, the sum of PIECE_VALUE less the king
+
+   // every square each side attacks, and every square the piece on
+   // each location attacks, only kept up to date by makeMove() and
+   // unmakeMove() when fAttackMaps is set
+   bool fAttackMaps;
+   Bitboard bbAttacks[2];
+   Bitboard bbAttacksFrom[64];
 
    ogstream* pgout;
 };
@@ -75,7 +244,7 @@ class BoardDummy : public Board
 {
    friend TestBoard;
 public:
-   BoardDummy()
+   BoardDummy() : Board(nullptr, true /*noreset*/)
    {
       numMoves = 0;
       for (int row = 0; row < 8; ++row)
@@ -85,7 +254,16 @@ public:
       }
    }
 
-   ~BoardDummy() {}
+   // the tests own whatever they put in the array, so do not let
+   // Board::free() delete it
+   ~BoardDummy()
+   {
+      for (int row = 0; row < 8; ++row)
+      {
+         for (int col = 0; col < 8; ++col)
+            board[col][row] = nullptr;
+      }
+   }
 
    void display(const Position& posHover,
       const Position& posSelect) const {
@@ -130,5 +308,9 @@ public:
          return *pSpace;
    }
    int  getCurrentMove() const { return moveNumber; }
+
+   // the tests put their pieces straight into the array, so once
+   // they are all there this puts them on the squares as well
+   void placePieces();
 };
 
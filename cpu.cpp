@@ -0,0 +1,129 @@
+/***********************************************************************
+ * Source File:
+ *    CPU
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    Ask CPUID about the processor
+ ************************************************************************/
+
+#include "cpu.h"
+#include <cstring>     // for memcpy in cpuName()
+
+#if defined(_MSC_VER)
+#include <intrin.h>    // for __cpuid
+#elif defined(__GNUC__) && defined(__x86_64__)
+#include <cpuid.h>     // for __cpuid_count
+#endif
+
+/***************************************************
+ * CPUID
+ * Ask the processor about itself, sub-leaf 0
+ **************************************************/
+#if defined(_MSC_VER) && defined(_M_X64)
+static void cpuid(unsigned int leaf, unsigned int regs[4])
+{
+   int info[4];
+   __cpuidex(info, (int)leaf, 0);
+   for (int i = 0; i < 4; i++)
+      regs[i] = (unsigned int)info[i];
+}
+#elif defined(__GNUC__) && defined(__x86_64__)
+static void cpuid(unsigned int leaf, unsigned int regs[4])
+{
+   __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+}
+#endif
+
+/***************************************************
+ * CPU HAS FAST PEXT
+ * BMI2 is CPUID leaf 7, EBX bit 8. AMD parts before
+ * Zen 3 (family 0x19) have it, but in microcode at
+ * hundreds of cycles, so they are better off with magics
+ **************************************************/
+bool cpuHasFastPext()
+{
+#if (defined(_MSC_VER) && defined(_M_X64)) || (defined(__GNUC__) && defined(__x86_64__))
+   unsigned int regs[4];   // eax, ebx, ecx, edx
+   cpuid(0, regs);
+   if (regs[0] < 7)
+      return false;
+
+   // "AuthenticAMD" comes back in ebx, edx, ecx
+   bool fAmd = regs[1] == 0x68747541 && regs[3] == 0x69746e65 &&
+               regs[2] == 0x444d4163;
+
+   cpuid(1, regs);
+   unsigned int family = ((regs[0] >> 8) & 0xf) + ((regs[0] >> 20) & 0xff);
+
+   cpuid(7, regs);
+   bool fBmi2 = (regs[1] >> 8) & 1;
+
+   return fBmi2 && !(fAmd && family < 0x19);
+#else
+   return false;
+#endif
+}
+
+/***************************************************
+ * CPU HAS AVX2
+ * AVX2 is CPUID leaf 7, EBX bit 5, but the operating
+ * system also has to save the YMM registers, which
+ * XGETBV reports once OSXSAVE (leaf 1, ECX bit 27) is set
+ **************************************************/
+bool cpuHasAvx2()
+{
+#if (defined(_MSC_VER) && defined(_M_X64)) || (defined(__GNUC__) && defined(__x86_64__))
+   unsigned int regs[4];   // eax, ebx, ecx, edx
+   cpuid(0, regs);
+   if (regs[0] < 7)
+      return false;
+
+   cpuid(1, regs);
+   if (!((regs[2] >> 27) & 1))
+      return false;
+#if defined(_MSC_VER)
+   unsigned long long xcr0 = _xgetbv(0);
+#else
+   unsigned int xcrLow, xcrHigh;
+   __asm__("xgetbv" : "=a"(xcrLow), "=d"(xcrHigh) : "c"(0));
+   unsigned long long xcr0 = xcrLow;
+#endif
+   if ((xcr0 & 0x6) != 0x6)   // SSE and AVX state both enabled
+      return false;
+
+   cpuid(7, regs);
+   return (regs[1] >> 5) & 1;
+#else
+   return false;
+#endif
+}
+
+/***************************************************
+ * CPU NAME
+ * The brand string, CPUID leaves 0x80000002 through
+ * 0x80000004, sixteen characters in each. Benchmark
+ * results are only comparable on the same processor
+ **************************************************/
+void cpuName(char name[49])
+{
+   name[0] = '\0';
+#if (defined(_MSC_VER) && defined(_M_X64)) || (defined(__GNUC__) && defined(__x86_64__))
+   unsigned int regs[4];
+   cpuid(0x80000000, regs);
+   if (regs[0] < 0x80000004)
+      return;
+   for (unsigned int leaf = 0; leaf < 3; leaf++)
+   {
+      cpuid(0x80000002 + leaf, regs);
+      memcpy(name + leaf * 16, regs, 16);
+   }
+   name[48] = '\0';
+
+   // some processors pad the front with spaces
+   char* begin = name;
+   while (*begin == ' ')
+      begin++;
+   memmove(name, begin, strlen(begin) + 1);
+#endif
+}
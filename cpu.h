@@ -0,0 +1,16 @@
+/***********************************************************************
+ * Header File:
+ *    CPU
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    What the processor is and which of its instructions are worth
+ *    using, asked of CPUID. Kept apart from the slider tables so a
+ *    program can ask without building them
+ ************************************************************************/
+
+#pragma once
+
+bool cpuHasFastPext();
+bool cpuHasAvx2();
+void cpuName(char name[49]);
@@ -0,0 +1,62 @@
+/***********************************************************************
+ * Source File:
+ *    LEAPER
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    The knight, king and pawn attack tables, built at compile time
+ ************************************************************************/
+
+#include "leaper.h"
+
+/***************************************************
+ * JUMPS
+ * The set reached from one location by a list of
+ * (dCol, dRow) jumps, dropping any that leave the board
+ **************************************************/
+static constexpr Bitboard jumps(int location, const int deltas[][2], int numDelta)
+{
+   Bitboard attacks = 0;
+   for (int i = 0; i < numDelta; i++)
+   {
+      int c = location % 8 + deltas[i][0];
+      int r = location / 8 + deltas[i][1];
+      if (0 <= c && c < 8 && 0 <= r && r < 8)
+         attacks |= 1ULL << (r * 8 + c);
+   }
+   return attacks;
+}
+
+/***************************************************
+ * BUILD LEAPERS
+ **************************************************/
+static constexpr LeaperAttacks buildLeapers()
+{
+   const int knight[8][2] =
+   {
+               { -1,  2 }, { 1,  2 },
+      { -2,  1 },                     { 2,  1 },
+      { -2, -1 },                     { 2, -1 },
+               { -1, -2 }, { 1, -2 }
+   };
+   const int king[8][2] =
+   {
+      { -1,  1 }, { 0,  1 }, { 1,  1 },
+      { -1,  0 },            { 1,  0 },
+      { -1, -1 }, { 0, -1 }, { 1, -1 }
+   };
+   const int pawnWhite[2][2] = { { -1,  1 }, { 1,  1 } };
+   const int pawnBlack[2][2] = { { -1, -1 }, { 1, -1 } };
+
+   LeaperAttacks leapers = {};
+   for (int location = 0; location < 64; location++)
+   {
+      leapers.knight[location]      = jumps(location, knight, 8);
+      leapers.king[location]        = jumps(location, king, 8);
+      leapers.pawn[WHITE][location] = jumps(location, pawnWhite, 2);
+      leapers.pawn[BLACK][location] = jumps(location, pawnBlack, 2);
+   }
+   return leapers;
+}
+
+constexpr LeaperAttacks LEAPERS = buildLeapers();
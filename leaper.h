@@ -0,0 +1,45 @@
+/***********************************************************************
+ * Header File:
+ *    LEAPER
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    Attack sets for the pieces that jump rather than slide (knight,
+ *    king, and the pawn's diagonal captures), one per square, worked
+ *    out by the compiler
+ ************************************************************************/
+
+#pragma once
+
+#include "bitboard.h"
+
+/***************************************************
+ * LEAPER ATTACKS
+ * Indexed by location; the pawns also by Color
+ **************************************************/
+struct LeaperAttacks
+{
+   Bitboard knight[64];
+   Bitboard king[64];
+   Bitboard pawn[2][64];
+};
+
+extern const LeaperAttacks LEAPERS;
+
+inline Bitboard knightAttacks(int location)
+{
+   assert(0 <= location && location < 64);
+   return LEAPERS.knight[location];
+}
+
+inline Bitboard kingAttacks(int location)
+{
+   assert(0 <= location && location < 64);
+   return LEAPERS.king[location];
+}
+
+inline Bitboard pawnAttacks(bool fWhite, int location)
+{
+   assert(0 <= location && location < 64);
+   return LEAPERS.pawn[colorFrom(fWhite)][location];
+}
@@ -32,12 +32,60 @@ castleQ(false), error("")
  * MOVE : STRING CONSTRUCTOR
  * Initialize a move from a text string (e.g., "e5e6")
  ***************************************************/
-Move::Move(const string& str) : text(str)
+Move::Move(const string& str) : Move()
 {
    // Use the read method to parse the string
    read(str);
 }
 
+/***************************************************
+ * MOVE : CODE CONSTRUCTOR
+ * Unpack a move from its 16-bit form. The code does
+ * not say what was captured, so the caller does
+ ***************************************************/
+Move::Move(MoveCode code, bool isWhite, PieceType capture) : Move()
+{
+   source = Position(code.getSrc());
+   dest = Position(code.getDest());
+   moveType = MOVE;
+   this->isWhite = isWhite;
+   this->capture = capture;
+   promote = code.getPromotion();
+
+   if (code.isEnPassant())
+   {
+      setEnPassant();
+      this->capture = PAWN;
+   }
+   else if (code.getFlags() == MoveCode::CASTLE_KING)
+      setCastle(true);
+   else if (code.getFlags() == MoveCode::CASTLE_QUEEN)
+      setCastle(false);
+}
+
+/***************************************************
+ * MOVE : GET CODE
+ * Pack this move into 16 bits
+ ***************************************************/
+MoveCode Move::getCode() const
+{
+   int flags = MoveCode::QUIET;
+   if (enpassant)
+      flags = MoveCode::ENPASSANT;
+   else if (castleK)
+      flags = MoveCode::CASTLE_KING;
+   else if (castleQ)
+      flags = MoveCode::CASTLE_QUEEN;
+   else
+   {
+      if (promote != SPACE && promote != INVALID)
+         flags |= MoveCode::promoteFlag(promote);
+      if (capture != SPACE && capture != INVALID)
+         flags |= MoveCode::CAPTURE;
+   }
+   return MoveCode(source.getLocation(), dest.getLocation(), flags);
+}
+
 /***************************************************
  * MOVE : READ
  * Parse a move string and update this Move object
@@ -62,9 +110,38 @@ void Move::read(const string& str)
    // Default to a simple move
    moveType = MOVE;
 
-   // Process special move indicators (5th character, if present)
+   // Process special move indicators (5th character, if present).
+   // A capture that also promotes carries both letters: "b7a8rQ"
    if (str.length() >= 5)
       processSpecialMoveChar(str[4]);
+   if (str.length() >= 6)
+      processSpecialMoveChar(str[5]);
+}
+
+/***************************************************
+ * MOVE : WRITE
+ * The text of this move in the same notation read()
+ * takes: source, destination, then one letter for a
+ * capture, a castle or en passant, and the capital
+ * letter of the new piece for a promotion
+ ***************************************************/
+string Move::write() const
+{
+   if (!source.isValid() || !dest.isValid())
+      return string();
+
+   string str = source.getText() + dest.getText();
+   if (castleK)
+      str += 'c';
+   else if (castleQ)
+      str += 'C';
+   else if (enpassant)
+      str += 'E';
+   else if (capture != SPACE && capture != INVALID)
+      str += letterFromPieceType(capture);
+   if (promote != SPACE && promote != INVALID)
+      str += (char)toupper(letterFromPieceType(promote));
+   return str;
 }
 
 /***************************************************
@@ -88,6 +165,14 @@ void Move::processSpecialMoveChar(char specialChar)
       setEnPassant();
       capture = PAWN;
       break;
+
+   case 'Q':  // Promotion
+   case 'R':
+   case 'B':
+   case 'N':
+      promote = pieceTypeFromLetter(specialChar);
+      break;
+
    default:   // Must be a capture or other indicator
       if (islower(specialChar) || specialChar == ' ')
          capture = pieceTypeFromLetter(specialChar);
@@ -170,3 +255,23 @@ void Move::assign(Move& move)
    castleQ = move.castleQ;
    error = move.error;
 }
+
+/***************************************************
+ * MOVE : INSERTION
+ ***************************************************/
+ostream& operator << (ostream& out, const Move& move)
+{
+   out << move.write();
+   return out;
+}
+
+/***************************************************
+ * MOVE : EXTRACTION
+ ***************************************************/
+istream& operator >> (istream& in, Move& move)
+{
+   string text;
+   if (in >> text)
+      move.read(text);
+   return in;
+}
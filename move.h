@@ -12,6 +12,7 @@
 #include <string>
 #include "position.h"  // Every move has two Positions as attributes
 #include "pieceType.h" // A piece type
+#include "moveCode.h"  // The packed form of a move
 
 using std::string;
 using std::ostream;
@@ -47,9 +48,14 @@ public:
    // Constructors
    Move();
    Move(const string& str);
+   Move(MoveCode code, bool isWhite, PieceType capture = SPACE);
+
+   // The packed 16-bit form
+   MoveCode getCode() const;
 
    // Methods related to move text and parsing
    void read(const string& str);
+   string write() const;
    string getText() const { return text; }
    void assign(string str) { read(str); }
 
@@ -94,7 +100,14 @@ public:
    // Operators
    bool operator==(const Move& rhs) const { return dest == rhs.dest && source == rhs.source && dest.getLocation() == rhs.dest.getLocation() && source.getLocation() == rhs.source.getLocation(); }
    bool operator!=(const Move& rhs) const { return !(*this == rhs); }
-   bool operator<(const Move& rhs) const { return dest < rhs.dest; }
+   bool operator<(const Move& rhs) const
+   {
+      if (source != rhs.source)
+         return source < rhs.source;
+      if (dest != rhs.dest)
+         return dest < rhs.dest;
+      return promote < rhs.promote;
+   }
 
 private:
    // Helper methods
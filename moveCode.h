@@ -0,0 +1,91 @@
+/***********************************************************************
+ * Header File:
+ *    MOVE CODE
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    A whole move packed into 16 bits: six for the source location,
+ *    six for the destination, and four for what kind of move it is.
+ *    This is what move generation, search and storage pass around;
+ *    the full Move class is for reading and showing moves
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cassert>
+#include <type_traits>
+#include "pieceType.h"
+
+/***************************************************
+ * MOVE CODE
+ *  15  12 11       6 5        0
+ * +------+----------+----------+
+ * | flag |   dest   |  source  |
+ * +------+----------+----------+
+ **************************************************/
+class MoveCode
+{
+public:
+   // the four flag bits. The promotion flags count up from
+   // PROMOTE in the order knight, bishop, rook, queen, and
+   // CAPTURE is ORed in when the promotion also captures
+   enum Flag : uint16_t
+   {
+      QUIET        = 0,
+      CASTLE_KING  = 2,
+      CASTLE_QUEEN = 3,
+      CAPTURE      = 4,
+      ENPASSANT    = 5,
+      PROMOTE      = 8
+   };
+
+   MoveCode() = default;         // left uninitialized, so lists are free
+   constexpr MoveCode(int src, int dest, int flags = QUIET) :
+      bits((uint16_t)(src | (dest << 6) | (flags << 12))) {}
+
+   // the parts
+   constexpr int  getSrc()   const { return bits & 0x3f;          }
+   constexpr int  getDest()  const { return (bits >> 6) & 0x3f;   }
+   constexpr int  getFlags() const { return bits >> 12;           }
+   constexpr uint16_t raw()  const { return bits;                 }
+
+   // what kind of move
+   constexpr bool isCapture()   const { return (getFlags() & CAPTURE) != 0;   }
+   constexpr bool isEnPassant() const { return getFlags() == ENPASSANT;       }
+   constexpr bool isCastle()    const { return getFlags() == CASTLE_KING ||
+                                               getFlags() == CASTLE_QUEEN;    }
+   constexpr bool isPromotion() const { return (getFlags() & PROMOTE) != 0;   }
+   PieceType getPromotion() const
+   {
+      static const PieceType promotions[4] = { KNIGHT, BISHOP, ROOK, QUEEN };
+      return isPromotion() ? promotions[getFlags() & 0x3] : SPACE;
+   }
+
+   // the promotion flags for a piece type
+   static int promoteFlag(PieceType pt)
+   {
+      switch (pt)
+      {
+         case KNIGHT: return PROMOTE | 0;
+         case BISHOP: return PROMOTE | 1;
+         case ROOK:   return PROMOTE | 2;
+         case QUEEN:  return PROMOTE | 3;
+         default:     assert(false); return QUIET;
+      }
+   }
+
+   constexpr bool operator == (const MoveCode& rhs) const { return bits == rhs.bits; }
+   constexpr bool operator != (const MoveCode& rhs) const { return bits != rhs.bits; }
+   constexpr bool operator <  (const MoveCode& rhs) const { return bits <  rhs.bits; }
+
+private:
+   uint16_t bits;
+};
+
+// no move at all: a1 to a1 can never be played
+const MoveCode MOVE_NONE(0, 0);
+
+static_assert(sizeof(MoveCode) == 2, "MoveCode is two bytes");
+static_assert(std::is_trivially_copyable<MoveCode>::value,
+              "MoveCode must copy with memcpy");
@@ -0,0 +1,60 @@
+/***********************************************************************
+ * Header File:
+ *    MOVE LIST
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    A fixed-capacity list of moves that lives on the stack. No legal
+ *    chess position has more than 218 moves, so 256 slots is always
+ *    enough and move generation never touches the heap
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include "moveCode.h"
+
+/***************************************************
+ * MOVE LIST
+ * Reads like a span: data(), size(), begin(), end()
+ **************************************************/
+class MoveList
+{
+public:
+   static const int CAPACITY = 256;
+
+   MoveList() : num(0) {}
+
+   // adding and removing
+   void push_back(MoveCode move)
+   {
+      assert(num < CAPACITY);
+      moves[num++] = move;
+   }
+   void clear() { num = 0; }
+
+   // looking
+   int  size()  const { return num;      }
+   bool empty() const { return num == 0; }
+   bool contains(MoveCode move) const
+   {
+      for (MoveCode m : *this)
+         if (m == move)
+            return true;
+      return false;
+   }
+   MoveCode& operator [] (int i)       { assert(0 <= i && i < num); return moves[i]; }
+   MoveCode  operator [] (int i) const { assert(0 <= i && i < num); return moves[i]; }
+
+   // span
+   MoveCode*       data()        { return moves;       }
+   const MoveCode* data()  const { return moves;       }
+   MoveCode*       begin()       { return moves;       }
+   MoveCode*       end()         { return moves + num; }
+   const MoveCode* begin() const { return moves;       }
+   const MoveCode* end()   const { return moves + num; }
+
+private:
+   MoveCode moves[CAPACITY];   // not initialized until pushed
+   int num;
+};
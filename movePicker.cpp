@@ -0,0 +1,167 @@
+/***********************************************************************
+ * Source File:
+ *    MOVE PICKER
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    Hands a search the moves of one position one at a time, best
+ *    guesses first, generating each group only when it is reached
+ ************************************************************************/
+
+#include "movePicker.h"
+#include "board.h"
+
+/***************************************************
+ * MOVE PICKER : CONSTRUCTOR
+ * Nothing is generated yet
+ **************************************************/
+MovePicker::MovePicker(const Board& board, MoveCode hashMove,
+                       MoveCode killer1, MoveCode killer2) :
+   board(board), stage(STAGE_HASH), fGoodCapturesOnly(false),
+   hashMove(hashMove), iKiller(0),
+   iCapture(0), iBad(0), iQuiet(0)
+{
+   killers[0] = killer1;
+   killers[1] = killer2;
+}
+
+/***************************************************
+ * MOVE PICKER : NEXT
+ * Work through the stages, each one falling into the
+ * next when it has nothing more to give. Moves handed
+ * out by an earlier stage are skipped by the later ones,
+ * and a hash or killer move that was not handed out is
+ * forgotten so it still comes up in its own stage
+ **************************************************/
+MoveCode MovePicker::next()
+{
+   switch (stage)
+   {
+      case STAGE_HASH:
+         stage = STAGE_CAPTURES_INIT;
+         if (board.isPseudoLegal(hashMove))
+            return hashMove;
+         hashMove = MOVE_NONE;       // stale, so nothing later skips it
+         // fall through
+
+      case STAGE_CAPTURES_INIT:
+         board.generateCaptures(captures);
+         for (int i = 0; i < captures.size(); i++)
+            scores[i] = scoreCapture(captures[i]);
+         stage = STAGE_GOOD_CAPTURES;
+         // fall through
+
+      case STAGE_GOOD_CAPTURES:
+         while (iCapture < captures.size())
+         {
+            MoveCode move = pickBestCapture();
+            if (move == hashMove)
+               continue;
+            if (!isGoodCapture(move))
+            {
+               badCaptures.push_back(move);
+               continue;
+            }
+            return move;
+         }
+         if (fGoodCapturesOnly)
+         {
+            stage = STAGE_DONE;
+            break;
+         }
+         stage = STAGE_KILLERS;
+         // fall through
+
+      case STAGE_KILLERS:
+         while (iKiller < 2)
+         {
+            MoveCode move = killers[iKiller++];
+            if (move != hashMove && !move.isCapture() && !move.isPromotion() &&
+                (iKiller == 1 || move != killers[0]) &&
+                board.isPseudoLegal(move))
+               return move;
+            killers[iKiller - 1] = MOVE_NONE;
+         }
+         stage = STAGE_QUIETS_INIT;
+         // fall through
+
+      case STAGE_QUIETS_INIT:
+         board.generateQuiets(quiets);
+         stage = STAGE_QUIETS;
+         // fall through
+
+      case STAGE_QUIETS:
+         while (iQuiet < quiets.size())
+         {
+            MoveCode move = quiets[iQuiet++];
+            if (move != hashMove && move != killers[0] && move != killers[1])
+               return move;
+         }
+         stage = STAGE_BAD_CAPTURES;
+         // fall through
+
+      case STAGE_BAD_CAPTURES:
+         if (iBad < badCaptures.size())
+            return badCaptures[iBad++];
+         stage = STAGE_DONE;
+         // fall through
+
+      case STAGE_DONE:
+         break;
+   }
+   return MOVE_NONE;
+}
+
+/***************************************************
+ * MOVE PICKER : SCORE CAPTURE
+ * Most valuable victim, least valuable attacker:
+ * taking a queen with a pawn comes before taking a
+ * pawn with a queen. A promotion adds the new piece
+ **************************************************/
+int MovePicker::scoreCapture(MoveCode move) const
+{
+   PieceType victim = move.isEnPassant() ? PAWN : board.getPieceType(move.getDest());
+   PieceType attacker = board.getPieceType(move.getSrc());
+   return (PIECE_VALUE[victim] + PIECE_VALUE[move.getPromotion()]) * 16 -
+          PIECE_VALUE[attacker] / 100;
+}
+
+/***************************************************
+ * MOVE PICKER : PICK BEST CAPTURE
+ * One step of a selection sort: swap the best of
+ * the captures not yet handed out to the front.
+ * Cheaper than sorting, since most nodes only ever
+ * look at the first one or two
+ **************************************************/
+MoveCode MovePicker::pickBestCapture()
+{
+   int iBest = iCapture;
+   for (int i = iCapture + 1; i < captures.size(); i++)
+      if (scores[i] > scores[iBest])
+         iBest = i;
+
+   MoveCode best = captures[iBest];
+   captures[iBest] = captures[iCapture];
+   scores[iBest]   = scores[iCapture];
+   captures[iCapture] = best;
+   iCapture++;
+   return best;
+}
+
+/***************************************************
+ * MOVE PICKER : IS GOOD CAPTURE
+ * A capture wins material if the victim, plus any
+ * promotion, is worth at least as much as the
+ * attacker, or if nothing can
+ * take back. This is not a full exchange count, but
+ * it is one lookup and catches the usual blunders
+ **************************************************/
+bool MovePicker::isGoodCapture(MoveCode move) const
+{
+   if (move.isEnPassant())
+      return true;
+   PieceType victim   = board.getPieceType(move.getDest());
+   PieceType attacker = board.getPieceType(move.getSrc());
+   return PIECE_VALUE[victim] + PIECE_VALUE[move.getPromotion()] >= PIECE_VALUE[attacker] ||
+          !board.isSquareAttacked(move.getDest(), !board.whiteTurn());
+}
@@ -0,0 +1,78 @@
+/***********************************************************************
+ * Header File:
+ *    MOVE PICKER
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    Hands a search the moves of one position one at a time, best
+ *    guesses first, generating each group only when the one before it
+ *    has run out. Most alpha-beta nodes cut off after a move or two,
+ *    so the quiet moves are usually never generated at all
+ ************************************************************************/
+
+#pragma once
+
+#include "moveList.h"
+
+class Board;
+class TestMovePicker;
+
+/***************************************************
+ * MOVE PICKER
+ * The stages, in the order they are handed out:
+ *    1. the hash move, if it can be played here
+ *    2. captures and promotions that win material,
+ *       biggest gain first
+ *    3. the two killer moves, if they are quiet and playable
+ *    4. every other quiet move
+ *    5. captures that look like they lose material
+ * The moves are pseudo-legal: the search still has to
+ * throw out any that leave its own king in check
+ **************************************************/
+class MovePicker
+{
+   friend TestMovePicker;
+public:
+   MovePicker(const Board& board, MoveCode hashMove = MOVE_NONE,
+              MoveCode killer1 = MOVE_NONE, MoveCode killer2 = MOVE_NONE);
+
+   // the next move, or MOVE_NONE when there are no more
+   MoveCode next();
+
+   // stop after the captures that win material, for a
+   // quiescence search that only wants those
+   void goodCapturesOnly() { fGoodCapturesOnly = true; }
+
+private:
+   enum Stage
+   {
+      STAGE_HASH,
+      STAGE_CAPTURES_INIT,
+      STAGE_GOOD_CAPTURES,
+      STAGE_KILLERS,
+      STAGE_QUIETS_INIT,
+      STAGE_QUIETS,
+      STAGE_BAD_CAPTURES,
+      STAGE_DONE
+   };
+
+   bool     isGoodCapture(MoveCode move) const;
+   int      scoreCapture(MoveCode move)  const;
+   MoveCode pickBestCapture();
+
+   const Board& board;
+   Stage    stage;
+   bool     fGoodCapturesOnly;
+   MoveCode hashMove;
+   MoveCode killers[2];
+   int      iKiller;
+
+   MoveList captures;                      // generated in STAGE_CAPTURES_INIT
+   int      scores[MoveList::CAPACITY];    // one per capture
+   int      iCapture;
+   MoveList badCaptures;                   // put off until the end
+   int      iBad;
+
+   MoveList quiets;                        // generated in STAGE_QUIETS_INIT
+   int      iQuiet;
+};
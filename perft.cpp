@@ -0,0 +1,318 @@
+/***********************************************************************
+ * Source File:
+ *    PERFT
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    Count every position a given number of moves ahead of a FEN and
+ *    show how many come from each first move (the "divide"). The totals
+ *    for well-known positions are published, so this both checks the
+ *    move generator and times it. No window is opened. Deep counts
+ *    can be split across threads, each with a board of its own, and
+ *    sped up by counting the last ply in bulk and remembering counts.
+ *
+ *    usage: perft [-t threads] [-s split] [-b] [-m MB] <depth> [fen]
+ *       perft 5
+ *       perft -t 0 -s 2 7
+ *       perft -b -m 64 6
+ *       perft 3 r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1
+ ************************************************************************/
+
+#include "board.h"
+#include "perftTable.h"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/***************************************************
+ * WRITE MOVE
+ * The move the way other engines print it: source,
+ * destination, and a small letter for a promotion
+ **************************************************/
+static void writeMove(MoveCode move, char* buf)
+{
+   static const char promotions[8] = { 0, 0, 'k', 'q', 'r', 'b', 'n', 'p' };
+   *buf++ = (char)('a' + move.getSrc()  % 8);
+   *buf++ = (char)('1' + move.getSrc()  / 8);
+   *buf++ = (char)('a' + move.getDest() % 8);
+   *buf++ = (char)('1' + move.getDest() / 8);
+   if (move.isPromotion())
+      *buf++ = promotions[move.getPromotion()];
+   *buf = '\0';
+}
+
+/***************************************************
+ * TASK
+ * One piece of a parallel perft: the moves from the
+ * root down to the split depth, and what was counted
+ * below them
+ **************************************************/
+const int MAX_SPLIT = 4;
+struct Task
+{
+   MoveCode path[MAX_SPLIT];  // the moves leading here
+   int      root;             // which root move it falls under
+   uint64_t nodes;            // filled in by a worker
+};
+
+/***************************************************
+ * LIST TASKS
+ * Every line of play split plies deep, in the order
+ * the moves are generated so the totals always come
+ * out in the same order
+ **************************************************/
+static void listTasks(Board& board, int split, int ply, Task& task,
+                      vector<Task>& tasks)
+{
+   if (ply == split)
+   {
+      tasks.push_back(task);
+      return;
+   }
+
+   MoveList moves;
+   board.generateLegalMoves(moves);
+   for (int i = 0; i < moves.size(); i++)
+   {
+      if (ply == 0)
+         task.root = i;
+      task.path[ply] = moves[i];
+      board.makeMove(moves[i]);
+      listTasks(board, split, ply + 1, task, tasks);
+      board.unmakeMove();
+   }
+}
+
+/***************************************************
+ * OPTIONS
+ * How to count, from the command line
+ **************************************************/
+struct Options
+{
+   int  numThreads;   // -t, 0 for one per core
+   int  split;        // -s, plies deep to cut the tree into tasks
+   bool fBulk;        // -b, count the last ply without making it
+   int  hashMB;       // -m, megabytes of table per thread, 0 for none
+};
+
+/***************************************************
+ * TALLY
+ * What one run counted
+ **************************************************/
+struct Tally
+{
+   vector<uint64_t> counts;   // one per root move
+   uint64_t nodes;
+   uint64_t probes;           // of the tables, summed over the threads
+   uint64_t hits;
+   double   seconds;
+};
+
+/***************************************************
+ * WORK
+ * One thread's share: set up its own board and table
+ * from the FEN, then keep taking the next task nobody
+ * has yet until they are all gone. Each task's count
+ * goes in its own slot, so nothing else is shared
+ **************************************************/
+static void work(const string& fen, int depth, const Options& options,
+                 vector<Task>& tasks, atomic<size_t>& next,
+                 atomic<uint64_t>& probes, atomic<uint64_t>& hits)
+{
+   Board board(nullptr, true /*noreset*/);
+   board.setFEN(fen);
+   unique_ptr<PerftTable> table;
+   if (options.hashMB > 0)
+      table.reset(new PerftTable(options.hashMB));
+
+   for (size_t i = next++; i < tasks.size(); i = next++)
+   {
+      Task& task = tasks[i];
+      for (int ply = 0; ply < options.split; ply++)
+         board.makeMove(task.path[ply]);
+      task.nodes = board.perft(depth - options.split, options.fBulk, table.get());
+      for (int ply = 0; ply < options.split; ply++)
+         board.unmakeMove();
+   }
+
+   if (table)
+   {
+      probes += table->getProbes();
+      hits   += table->getHits();
+   }
+}
+
+/***************************************************
+ * RUN
+ * Cut the tree into tasks, hand them out to the
+ * threads, then add up the count under each root
+ * move in the order the moves were generated
+ **************************************************/
+static Tally run(const string& fen, int depth, const Options& options)
+{
+   Board board(nullptr, true /*noreset*/);
+   board.setFEN(fen);
+   MoveList moves;
+   board.generateLegalMoves(moves);
+
+   auto begin = chrono::steady_clock::now();
+   vector<Task> tasks;
+   Task task;
+   listTasks(board, options.split, 0, task, tasks);
+
+   atomic<size_t> next(0);
+   atomic<uint64_t> probes(0);
+   atomic<uint64_t> hits(0);
+   vector<thread> threads;
+   for (int i = 1; i < options.numThreads; i++)
+      threads.emplace_back(work, cref(fen), depth, cref(options),
+                           ref(tasks), ref(next), ref(probes), ref(hits));
+   work(fen, depth, options, tasks, next, probes, hits);
+   for (thread& t : threads)
+      t.join();
+   auto end = chrono::steady_clock::now();
+
+   Tally tally;
+   tally.counts.assign(moves.size(), 0);
+   for (const Task& t : tasks)
+      tally.counts[t.root] += t.nodes;
+   tally.nodes = 0;
+   for (uint64_t count : tally.counts)
+      tally.nodes += count;
+   tally.probes  = probes;
+   tally.hits    = hits;
+   tally.seconds = chrono::duration<double>(end - begin).count();
+   return tally;
+}
+
+/***************************************************
+ * SHOW
+ * One line of totals
+ **************************************************/
+static void show(const char* label, const Tally& tally)
+{
+   printf("%-8s %llu nodes   %.3f sec   %.0f nps\n", label,
+          (unsigned long long)tally.nodes, tally.seconds,
+          tally.seconds > 0.0 ? tally.nodes / tally.seconds : 0.0);
+}
+
+/***************************************************
+ * READ NUMBER
+ * A whole number, zero or more, with nothing after
+ * it, so "5x" or "-1" are not taken for 5 and -1
+ **************************************************/
+static bool readNumber(const char* text, int& number)
+{
+   const char* end = text + strlen(text);
+   from_chars_result result = from_chars(text, end, number);
+   return result.ec == errc() && result.ptr == end && end != text && number >= 0;
+}
+
+/***************************************************
+ * MAIN
+ * The options come first, then the depth, and the
+ * FEN is everything after it so it needs no quoting.
+ *    -t <threads>  how many threads, 0 for one per core
+ *    -s <split>    how many plies deep to cut the tree
+ *                  into tasks (1 splits at the root)
+ *    -b            count the last ply in bulk
+ *    -m <MB>       remember counts in a table this big
+ * With -b or -m the count is run again without them,
+ * to show how much faster they are
+ **************************************************/
+int main(int argc, char** argv)
+{
+   Options options = { 1, 1, false, 0 };
+   bool fValid = true;
+   int iArg = 1;
+   for (; fValid && iArg < argc && argv[iArg][0] == '-'; iArg++)
+   {
+      string option = argv[iArg];
+      if (option == "-b")
+         options.fBulk = true;
+      else if (iArg + 1 < argc && option == "-t")
+         fValid = readNumber(argv[++iArg], options.numThreads);
+      else if (iArg + 1 < argc && option == "-s")
+         fValid = readNumber(argv[++iArg], options.split);
+      else if (iArg + 1 < argc && option == "-m")
+         fValid = readNumber(argv[++iArg], options.hashMB);
+      else
+         fValid = false;
+   }
+   int depth = 0;
+   if (!fValid || iArg >= argc || !readNumber(argv[iArg++], depth))
+   {
+      printf("usage: %s [-t threads] [-s split] [-b] [-m MB] <depth> [fen]\n",
+             argv[0]);
+      return 1;
+   }
+   if (options.numThreads <= 0)
+      options.numThreads = max(1, (int)thread::hardware_concurrency());
+   options.split = max(1, min(min(options.split, MAX_SPLIT), depth));
+
+   string fen;
+   for (int i = iArg; i < argc; i++)
+   {
+      if (i > iArg)
+         fen += ' ';
+      fen += argv[i];
+   }
+   if (fen.empty())
+      fen = FEN_START;
+
+   Board board(nullptr, true /*noreset*/);
+   if (!board.setFEN(fen))
+   {
+      printf("not a valid FEN: %s\n", fen.c_str());
+      return 1;
+   }
+   if (depth <= 0)
+   {
+      printf("Nodes: %llu\n", (unsigned long long)board.perft(depth));
+      return 0;
+   }
+
+   // Divide: the count under each first move, in the order generated
+   Tally tally = run(fen, depth, options);
+   MoveList moves;
+   board.generateLegalMoves(moves);
+   for (int i = 0; i < moves.size(); i++)
+   {
+      char text[6];
+      writeMove(moves[i], text);
+      printf("%s: %llu\n", text, (unsigned long long)tally.counts[i]);
+   }
+
+   printf("\n");
+   printf("Depth:   %d\n", depth);
+   printf("Threads: %d\n", options.numThreads);
+   show(options.fBulk || options.hashMB ? "Fast:" : "Nodes:", tally);
+
+   // The same count the plain way, to see what the shortcuts bought
+   if (options.fBulk || options.hashMB)
+   {
+      Options plain = options;
+      plain.fBulk  = false;
+      plain.hashMB = 0;
+      Tally slow = run(fen, depth, plain);
+      show("Plain:", slow);
+      if (slow.nodes != tally.nodes)
+         printf("MISMATCH: the shortcuts changed the count\n");
+      printf("Speedup: %.2fx\n", tally.seconds > 0.0 ? slow.seconds / tally.seconds : 0.0);
+      if (options.hashMB)
+         printf("Hash:    %llu hits of %llu probes (%.1f%%)\n",
+                (unsigned long long)tally.hits, (unsigned long long)tally.probes,
+                tally.probes ? 100.0 * tally.hits / tally.probes : 0.0);
+      return slow.nodes == tally.nodes ? 0 : 1;
+   }
+   return 0;
+}
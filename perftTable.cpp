@@ -0,0 +1,53 @@
+/***********************************************************************
+ * Source File:
+ *    PERFT TABLE
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    A fixed-size table of leaf counts keyed by position and depth
+ ************************************************************************/
+
+#include "perftTable.h"
+
+/***************************************************
+ * PERFT TABLE : CONSTRUCTOR
+ * As many entries as fit in the given size, rounded
+ * down to a power of two so a mask finds the slot.
+ * This is the only allocation the table makes
+ **************************************************/
+PerftTable::PerftTable(int megabytes) : mask(0), probes(0), hits(0)
+{
+   uint64_t size = 1;
+   uint64_t bytes = (uint64_t)(megabytes > 0 ? megabytes : 1) << 20;
+   while (size * 2 * sizeof(Entry) <= bytes)
+      size *= 2;
+   entries.assign(size, Entry{ 0, 0, 0 });
+   mask = size - 1;
+}
+
+/***************************************************
+ * PERFT TABLE : PROBE
+ * The depth is mixed into the slot so the same
+ * position at different depths does not fight over it
+ **************************************************/
+bool PerftTable::probe(uint64_t hash, int depth, uint64_t& nodes)
+{
+   probes++;
+   const Entry& entry = entries[(hash ^ (uint64_t)depth) & mask];
+   if (entry.hash != hash || entry.depth != depth)
+      return false;
+   hits++;
+   nodes = entry.nodes;
+   return true;
+}
+
+/***************************************************
+ * PERFT TABLE : STORE
+ **************************************************/
+void PerftTable::store(uint64_t hash, int depth, uint64_t nodes)
+{
+   Entry& entry = entries[(hash ^ (uint64_t)depth) & mask];
+   entry.hash  = hash;
+   entry.nodes = nodes;
+   entry.depth = depth;
+}
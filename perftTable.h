@@ -0,0 +1,48 @@
+/***********************************************************************
+ * Header File:
+ *    PERFT TABLE
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    A fixed-size table remembering how many leaves were counted
+ *    below a position, so perft never counts the same position twice
+ *    when different move orders lead to it
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/***************************************************
+ * PERFT TABLE
+ * Keyed by the Zobrist hash of the position and the
+ * depth still to go. One entry per slot, and a new
+ * count always replaces the old one
+ **************************************************/
+class PerftTable
+{
+public:
+   PerftTable(int megabytes);
+
+   // the count below a position, if it is remembered
+   bool probe(uint64_t hash, int depth, uint64_t& nodes);
+   void store(uint64_t hash, int depth, uint64_t nodes);
+
+   // how often a probe found its position
+   uint64_t getProbes() const { return probes; }
+   uint64_t getHits()   const { return hits;   }
+
+private:
+   struct Entry
+   {
+      uint64_t hash;
+      uint64_t nodes;
+      int      depth;     // 0 for an empty slot
+   };
+
+   std::vector<Entry> entries;   // a power of two of them
+   uint64_t mask;
+   uint64_t probes;
+   uint64_t hits;
+};
@@ -38,71 +38,36 @@ const Piece& Piece::operator = (const Piece& rhs)
 }
 
 /***************************************************
-* PIECE : GEN MOVES SLIDE
+* PIECE : GET MOVES
+*               The set of moves, for callers that want
+*               them sorted and searchable rather than fast
 ***************************************************/
-set<Move> Piece::getMovesSlide(const Board& board, const Delta deltas[], int numDelta) const
+void Piece::getMoves(set <Move>& moves, const Board& board) const
 {
-   set <Move> moves;
-   for (int i = 0; i < numDelta; i++)
-   {
-      Position posMove(position, deltas[i]);
-      while (posMove.isValid() && board[posMove] == SPACE)
-      {
-         Move move;
-         move.setSrc(position);
-         move.setDest(posMove);
-         move.setWhiteMove(isWhite());
-         moves.insert(move);
-
-         posMove += deltas[i];
-      }
-
-      if (posMove.isValid() && board[posMove].isWhite() != fWhite)
-      {
-         Move move;
-         move.setSrc(position);
-         move.setDest(posMove);
-         move.setWhiteMove(isWhite());
-         if (board[posMove] != SPACE)
-            move.setCapture(board[posMove].getType());
-         moves.insert(move);
-      }
-   }
+   MoveList list;
+   getMoves(list, board);
 
-   return moves;
+   moves.clear();
+   for (MoveCode code : list)
+      moves.insert(Move(code, isWhite(),
+                        code.isEnPassant() ? PAWN :
+                        code.isCapture()   ? board.getPieceType(code.getDest()) : SPACE));
 }
 
-
 /***************************************************
-* PIECE : GEN MOVES NO SLIDE
-*               From a list of deltas, find all the
-*               possible moves
+* PIECE : ADD MOVES TO
+*               One move for every square in the set
+*               of targets, flagging the captures
 ***************************************************/
-set <Move> Piece::getMovesNoSlide(const Board& board,
-   const Delta deltas[],
-   int numDelta) const
+void Piece::addMovesTo(MoveList& moves, const Board& board, Bitboard targets) const
 {
-   set<Move> moves;
-   for (int i = 0; i < numDelta; i++)
-   {
-      Position posMove(position, deltas[i]);
-      if (posMove.isValid())
-      {
-         const Piece& targetPiece = board[posMove];
-
-         // Can move to empty space or capture enemy piece
-         if (targetPiece == SPACE || targetPiece.isWhite() != fWhite)
-         {
-            Move move;
-            move.setSrc(getPosition());
-            move.setDest(posMove);
-            move.setWhiteMove(isWhite());
-            if (targetPiece != SPACE)
-               move.setCapture(targetPiece.getType());
-            moves.insert(move);
-         }
-      }
+   Bitboard occupied = board.getOccupied();
+   int src = position.getLocation();
 
+   while (targets)
+   {
+      int dest = popLsb(targets);
+      moves.push_back(MoveCode(src, dest, (occupied & squareBit(dest)) ?
+                                          MoveCode::CAPTURE : MoveCode::QUIET));
    }
-   return moves;
 }
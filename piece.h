@@ -15,7 +15,9 @@
 #include <cassert>
 #include "position.h"  // Because Position is a member variable
 #include "move.h"      // Because we return a set of Move
+#include "moveList.h"  // where the moves are generated into
 #include "pieceType.h" // A piece type.
+#include "bitboard.h"  // for Bitboard
 using std::set;
 
 // forward declaration because one of the Piece methods takes a Board
@@ -68,6 +70,8 @@ public:
    virtual bool justMoved(int currentMove) const { return currentMove - 1 == lastMove; }
 
    // setter
+   void setPosition(const Position& pos) { position = pos; }
+   void clearMoves()                     { nMoves = 0; lastMove = 0; }
    virtual void setLastMove(int currentMove) 
    { 
       lastMove = currentMove; 
@@ -77,7 +81,8 @@ public:
    // overwritten by the various pieces
    virtual PieceType getType()                                    const = 0;
    virtual void display(ogstream * pgout)                         const = 0;
-   void getMoves(set <Move>& moves, const Board& board) const {};
+   virtual void getMoves(MoveList& moves, const Board& board)     const {}
+   void getMoves(set <Move>& moves, const Board& board) const;
 
 protected:
 
@@ -85,8 +90,7 @@ protected:
    bool fWhite;                    // which team are you on?
    Position position;              // current position of this piece
    int  lastMove;                  // last time this piece moved
-   set <Move> getMovesSlide(const Board& board, const Delta deltas[], int numDelta) const;
-   set <Move> getMovesNoSlide(const Board& board, const Delta deltas[], int numDelta) const;
+   void addMovesTo(MoveList& moves, const Board& board, Bitboard targets) const;
 };
 
 
@@ -216,7 +220,7 @@ public:
    bool isWhite() const { return true; }
    PieceType getType() const { return pt; }
    int  getNMoves()                const { return nMoves; }
-   void getMoves(set <Move>& moves, const Board& board) const { }
+   void getMoves(MoveList& moves, const Board& board) const { }
    virtual bool justMoved(int currentMove) const { return currentMove - 1 == lastMove; }
 };
 
@@ -229,7 +233,7 @@ public:
    bool isWhite() const { return false; }
    PieceType getType() const { return pt; }
    int  getNMoves()                const { return nMoves; }
-   void getMoves(set <Move>& moves, const Board& board) const { }
+   void getMoves(MoveList& moves, const Board& board) const { }
    virtual bool justMoved(int currentMove) const { return currentMove - 1 == lastMove; }
 };
 
@@ -9,6 +9,7 @@
 
 #include "pieceBishop.h"
 #include "board.h"
+#include "slider.h"
 #include "uiDraw.h"    // for draw*()
 #include <iostream>
 
@@ -27,14 +28,8 @@ void Bishop::display(ogstream* pgout) const
 /**********************************************
  * BISHOP : GET POSITIONS
  *********************************************/
-void Bishop::getMoves(set <Move>& moves, const Board& board) const
+void Bishop::getMoves(MoveList& moves, const Board& board) const
 {
-   const Delta delta[] =
-   {
-      {-1,  1},   {1,  1},
-
-      {-1, -1},   {1, -1}
-   };
-
-   moves = getMovesSlide(board, delta, sizeof(delta) / sizeof(delta[0]));
+   Bitboard attacks = bishopAttacks(position.getLocation(), board.getOccupied());
+   addMovesTo(moves, board, attacks & ~board.getPieces(fWhite));
 }
@@ -22,6 +22,7 @@ public:
    Bishop(int c, int r, bool isWhite) : Piece(c, r, isWhite) {}
    ~Bishop() {}
    PieceType getType()            const { return BISHOP; }
-   void getMoves(set <Move>& moves, const Board& board) const;
+   using Piece::getMoves;
+   void getMoves(MoveList& moves, const Board& board) const;
    void display(ogstream* pgout)  const;
 };
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "pieceKing.h"
 #include "pieceRook.h"
 #include "board.h"
+#include "leaper.h"
 #include "uiDraw.h"
 #include <iostream>
 
@@ -29,17 +30,11 @@ void King::display(ogstream* pgout) const
  * KING : GET MOVES
  * Get all possible king moves including castling
  *********************************************/
-void King::getMoves(set <Move>& moves, const Board& board) const
+void King::getMoves(MoveList& moves, const Board& board) const
 {
-   const Delta delta[] =
-   {
-      { -1,  1 }, { 0,  1 }, { 1,  1 },
-      { -1,  0 },            { 1,  0 },
-      { -1, -1 }, { 0, -1 }, { 1, -1 }
-   };
-
    // Get basic king moves (one square in any direction)
-   moves = getMovesNoSlide(board, delta, sizeof(delta) / sizeof(delta[0]));
+   Bitboard attacks = kingAttacks(position.getLocation());
+   addMovesTo(moves, board, attacks & ~board.getPieces(fWhite));
 
    // Add castling moves if conditions are met
    addCastlingMoves(moves, board);
@@ -49,7 +44,7 @@ void King::getMoves(set <Move>& moves, const Board& board) const
  * KING : ADD CASTLING MOVES
  * Check if king can castle and add those moves
  *********************************************/
-void King::addCastlingMoves(set<Move>& moves, const Board& board) const
+void King::addCastlingMoves(MoveList& moves, const Board& board) const
 {
    // Can't castle if king has moved
    if (isMoved())
@@ -57,30 +52,19 @@ void King::addCastlingMoves(set<Move>& moves, const Board& board) const
 
    // Try king-side castle (short castle)
    if (canCastleKingSide(board))
-   {
-      Move castleMove;
-      castleMove.setSrc(position);
-      castleMove.setDest(Position(position.getCol() + 2, position.getRow()));
-      castleMove.setCastle(true); // true = king side
-      castleMove.setWhiteMove(isWhite());
-      moves.insert(castleMove);
-   }
+      moves.push_back(MoveCode(position.getLocation(), position.getLocation() + 2,
+                               MoveCode::CASTLE_KING));
 
    // Try queen-side castle (long castle)
    if (canCastleQueenSide(board))
-   {
-      Move castleMove;
-      castleMove.setSrc(position);
-      castleMove.setDest(Position(position.getCol() - 2, position.getRow()));
-      castleMove.setCastleQ(); // Queen side castle
-      castleMove.setWhiteMove(isWhite());
-      moves.insert(castleMove);
-   }
+      moves.push_back(MoveCode(position.getLocation(), position.getLocation() - 2,
+                               MoveCode::CASTLE_QUEEN));
 }
 
 /**********************************************
  * KING : CAN CASTLE KING SIDE
- * Check if king-side castling is possible
+ * Check if king-side castling is possible: nothing in
+ * the way, and no enemy eye on the squares the king uses
  *********************************************/
 bool King::canCastleKingSide(const Board& board) const
 {
@@ -109,12 +93,18 @@ bool King::canCastleKingSide(const Board& board) const
          return false;
    }
 
+   // The king may not castle out of, through, or into check
+   for (int c = col; c <= col + 2; c++)
+      if (board.isSquareAttacked(Position(c, row).getLocation(), !isWhite()))
+         return false;
+
    return true;
 }
 
 /**********************************************
  * KING : CAN CASTLE QUEEN SIDE
- * Check if queen-side castling is possible
+ * Check if queen-side castling is possible: nothing in
+ * the way, and no enemy eye on the squares the king uses
  *********************************************/
 bool King::canCastleQueenSide(const Board& board) const
 {
@@ -143,5 +133,11 @@ bool King::canCastleQueenSide(const Board& board) const
          return false;
    }
 
+   // The king may not castle out of, through, or into check; the
+   // rook alone crosses b1, so that one may be attacked
+   for (int c = col; c >= col - 2; c--)
+      if (board.isSquareAttacked(Position(c, row).getLocation(), !isWhite()))
+         return false;
+
    return true;
 }
@@ -22,11 +22,12 @@ public:
    King(int c, int r, bool isWhite) : Piece(c, r, isWhite) {}
    ~King() {}
    PieceType getType()            const { return KING; }
-   void getMoves(set <Move>& moves, const Board& board) const;
+   using Piece::getMoves;
+   void getMoves(MoveList& moves, const Board& board) const;
    void display(ogstream* pgout)  const;
 
 private:
-   void addCastlingMoves(set<Move>& moves, const Board& board) const;
+   void addCastlingMoves(MoveList& moves, const Board& board) const;
    bool canCastleKingSide(const Board& board) const;
    bool canCastleQueenSide(const Board& board) const;
 };
\ No newline at end of file
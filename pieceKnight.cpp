@@ -9,6 +9,7 @@
 
 #include "pieceKnight.h"
 #include "board.h"
+#include "leaper.h"
 #include "uiDraw.h"    // for draw*()
 #include <iostream>
 
@@ -27,17 +28,8 @@ void Knight::display(ogstream* pgout) const
 /***************************************************
 * KNIGHT: GET POSITIONS
 ***************************************************/
-void Knight::getMoves(set <Move>& moves, const Board& board) const
+void Knight::getMoves(MoveList& moves, const Board& board) const
 {
-   // possible positions relative to current position
-   const Delta delta[] =
-   {
-            {-1, 2},   { 1,  2},
-   {-2,  1},                      { 2,  1},
-   {-2, -1},                      { 2, -1},
-            { -1, -2}, { 1,  -2}
-   };
-
-   moves = getMovesNoSlide(board,
-      delta, sizeof(delta) / sizeof(delta[0]));
+   Bitboard attacks = knightAttacks(position.getLocation());
+   addMovesTo(moves, board, attacks & ~board.getPieces(fWhite));
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 #include "pieceQueen.h"
 #include "board.h"
+#include "slider.h"
 #include "uiDraw.h"    // for draw*()
 #include <iostream>
 
@@ -27,14 +28,8 @@ void Queen::display(ogstream* pgout) const
 /**********************************************
  * QUEEN : GET POSITIONS
  *********************************************/
-void Queen::getMoves(set <Move>& moves, const Board& board) const
+void Queen::getMoves(MoveList& moves, const Board& board) const
 {
-   const Delta delta[] =
-   {
-      { -1,  1 }, { 0,  1 }, { 1,  1 },
-      { -1,  0 },            { 1,  0 },
-      { -1, -1 }, { 0, -1 }, { 1, -1 }
-   };
-
-   moves = getMovesSlide(board, delta, sizeof(delta) / sizeof(delta[0]));
+   Bitboard attacks = queenAttacks(position.getLocation(), board.getOccupied());
+   addMovesTo(moves, board, attacks & ~board.getPieces(fWhite));
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 
 #include "pieceRook.h"
 #include "board.h"
+#include "slider.h"
 #include "uiDraw.h"    // for draw*()
 #include <iostream>
 
@@ -28,14 +29,8 @@ void Rook::display(ogstream* pgout) const
 /**********************************************
  * ROOK : GET POSITIONS
  *************************************************/
-void Rook::getMoves(set <Move>& moves, const Board& board) const
+void Rook::getMoves(MoveList& moves, const Board& board) const
 {
-   const Delta delta[] =
-   {
-                { 0,  1 },
-      { -1,  0 },            { 1,  0 },
-                { 0, -1 }
-   };
-
-   moves = getMovesSlide(board, delta, sizeof(delta) / sizeof(delta[0]));
+   Bitboard attacks = rookAttacks(position.getLocation(), board.getOccupied());
+   addMovesTo(moves, board, attacks & ~board.getPieces(fWhite));
 }
\ No newline at end of file
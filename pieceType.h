@@ -10,4 +10,31 @@
 
 #pragma once
 
-enum PieceType { INVALID, SPACE, KING, QUEEN, ROOK, BISHOP, KNIGHT, PAWN };
\ No newline at end of file
+#include <cstdint>
+
+enum PieceType { INVALID, SPACE, KING, QUEEN, ROOK, BISHOP, KNIGHT, PAWN };
+
+/***********************************************
+ * PIECE CODE
+ * A piece type and a color packed into one byte:
+ * the low three bits are the PieceType and bit 3
+ * is set for black. An empty square is just SPACE.
+ **********************************************/
+typedef uint8_t PieceCode;
+
+const PieceCode CODE_BLACK = 0x8;
+
+constexpr PieceCode pieceCode(PieceType pt, bool fWhite)
+{
+   return (PieceCode)(pt | (fWhite ? 0 : CODE_BLACK));
+}
+constexpr PieceType codeType(PieceCode code)  { return (PieceType)(code & 0x7); }
+constexpr bool      codeWhite(PieceCode code) { return !(code & CODE_BLACK);     }
+
+/***********************************************
+ * PIECE VALUE
+ * What each piece is worth in centipawns, indexed
+ * by PieceType. The king is priceless, so it gets
+ * more than everything else put together
+ **********************************************/
+const int PIECE_VALUE[8] = { 0, 0, 20000, 900, 500, 330, 320, 100 };
@@ -10,6 +10,10 @@
 #include "position.h"
 #include <iostream>
 
+// how big a square is drawn, kept here so programs without the UI link
+double Position::squareWidth  = (double)SIZE_SQUARE;
+double Position::squareHeight = (double)SIZE_SQUARE;
+
  /******************************************
   * POSITION COPY CONSTRUCTOR WITH DELTA
   ******************************************/
@@ -29,7 +33,7 @@ ostream& operator << (ostream& out, const Position& pos)
       return out << "??";         //
 
    char col = 'a' + pos.getCol(); //
-   char row = '8' - pos.getRow(); //
+   char row = '1' + pos.getRow(); //
    return out << col << row;
 }
 
@@ -45,105 +49,6 @@ istream& operator >> (istream& in, Position& pos)
 }
 
 
-/*************************************
- * IS INVALID
- **************************************/
-bool Position::isInvalid() const
-{
-   // Check if the position is completely invalid (0xff)
-   if (colRow == 0xff)
-      return true;
-
-   // Extract the row and column values
-   int row = colRow & 0x0F;
-   int col = (colRow >> 4) & 0x0F;
-
-   // Position is invalid if either row or column is outside range 0-7
-   return (row > 7 || col > 7);
-}
-
-/*************************************
- * IS VALID
- **************************************/
-bool Position::isValid() const
-{
-   // Check if this is a completely invalid position (0xff)
-   if (colRow == 0xff)
-      return false;
-
-   // Extract the row and column values
-   int row = colRow & 0x0F;
-   int col = (colRow >> 4) & 0x0F;
-
-   // Position is valid only if both row and column are in range 0-7
-   return (row <= 7 && col <= 7);
-}
-
-/*************************************
- * OPERATOR: =
- **************************************/
-const Position& Position::operator=(const Position& rhs)
-{
-   // Check for self-assignment
-   if (this == &rhs)
-      return *this;
-
-   // Copy the colRow value
-   this->colRow = rhs.colRow;
-
-   // Return a reference to the current object
-   return *this;
-}
-
-/*************************************
- * GET LOCATION
- **************************************/
-int Position::getLocation() const
-{
-   // Extract column from upper 4 bits
-   int col = (colRow >> 4) & 0x0F;
-
-   // Extract row from lower 4 bits
-   int row = colRow & 0x0F;
-
-   // Convert to location (0-63)
-   return row * 8 + col;
-}
-
-/*************************************
- * GET COLUMN
- **************************************/
-int Position::getCol() const
-{
-   // Check if this is an invalid position (0xff)
-   if (colRow == 0xff)
-      return -1;
-
-   // Extract the col and row values
-   int col = (colRow >> 4) & 0x0F;
-   int row = colRow & 0x0F;
-
-   // Check if either col or row is invalid (0-7)
-   return (col > 7 || row > 7) ? -1 : col;
-}
-
-/*************************************
- * GET ROW
- **************************************/
-int Position::getRow() const
-{
-   // Check if the position is invalid
-   if (colRow == 0xff)
-      return -1;
-
-   // Extract the row and col values
-   int row = colRow & 0x0F;
-   int col = (colRow >> 4) & 0x0F;
-
-   // Check if row is valid (0-7)
-   return (row > 7 || col > 7) ? -1 : row;
-}
-
 /*************************************
  * SET ROW
  **************************************/
@@ -176,37 +81,6 @@ void Position::setCol(int c)
    colRow = (colRow & 0x0F) | ((c & 0x0F) << 4);
 }
 
-/*************************************
- * SET
- **************************************/
-void Position::set(int c, int r)
-{
-   // Check if we're setting an invalid row or column
-   if (r < 0 || r > 7 || c < 0 || c > 7)
-   {
-      colRow = 0xff; // Mark as invalid position
-      return;
-   }
-
-   // Combine the column and row values into a single byte
-   colRow = ((c & 0x0F) << 4) | (r & 0x0F);
-}
-
-/*************************************
- * SET LOCATION
- **************************************/
-void Position::setLocation(int location)
-{  // example location: 57
-   if (location < 0 || location >= 64)
-   {
-      colRow = 0xff;
-      return;
-   }
-   int row = location / 8;
-   int col = location % 8;
-   set(col, row);
-}
-
 /*************************************
  * SET: XY
  **************************************/
@@ -337,7 +211,7 @@ string Position::getText() const
       return "??";
 
    char colChar = 'a' + getCol();
-   char rowChar = '8' - getRow();
+   char rowChar = '1' + getRow();
    string text = "";
    text += colChar;
    text += rowChar;
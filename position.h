@@ -11,6 +11,7 @@
 
 #include <string>
 #include <cstdint>
+#include <type_traits>
 using std::string;
 using std::ostream;
 using std::istream;
@@ -45,7 +46,11 @@ class TestBoard;
 
 /***************************************************
  * POSITION
- * The location of a piece on the board
+ * The location of a piece on the board. One byte, no
+ * vtable, and trivially copyable, so arrays of these can
+ * be copied with memcpy and built at compile time. The
+ * column is in the high nibble and the row in the low
+ * nibble; 0xff (or any nibble above 7) is invalid
  ***************************************************/
 class Position
 {
@@ -62,32 +67,37 @@ public:
 
    // Position :    The Position class can work with other positions,
    //               Allowing for comparisions, copying, etc.
-   Position(const Position& rhs) : colRow(rhs.colRow) {}
-   Position() : colRow(0xff) {}
+   constexpr Position() : colRow(0xff) {}
+   Position(const Position& rhs) = default;
+   Position& operator = (const Position& rhs) = default;
 
-   bool isInvalid() const;
-   bool isValid()   const;
+   // a row or column above 7 sets bit 3 of its nibble
+   constexpr bool isValid()   const { return (colRow & 0x88) == 0; }
+   constexpr bool isInvalid() const { return !isValid();            }
    void setValid() {} // dont know if we need these...
    void setInvalid() {}
-   bool operator <  (const Position& rhs) const { return this->colRow < rhs.colRow; }
-   bool operator == (const Position& rhs) const { return this->colRow == rhs.colRow; }
-   bool operator != (const Position& rhs) const { return this->colRow != rhs.colRow; }
-   const Position& operator=(const Position& rhs);
+   constexpr bool operator <  (const Position& rhs) const { return this->colRow < rhs.colRow; }
+   constexpr bool operator == (const Position& rhs) const { return this->colRow == rhs.colRow; }
+   constexpr bool operator != (const Position& rhs) const { return this->colRow != rhs.colRow; }
 
    // Location : The Position class can work with locations, which
    //            are 0...63 where we start in row 0, then row 1, etc.
-   Position(int location) { setLocation(location); }
-   int getLocation() const;
-   void setLocation(int location);
+   constexpr Position(int location) :
+      colRow((location < 0 || location >= 64) ? (uint8_t)0xff :
+             (uint8_t)(((location % 8) << 4) | (location / 8))) {}
+   constexpr int getLocation() const { return (colRow & 0x0f) * 8 + ((colRow >> 4) & 0x0f); }
+   void setLocation(int location) { *this = Position(location); }
 
    // Row/Col : The position class can work with row/column,
    //           which are 0..7 and 0...7
-   Position(int c, int r) { set(c, r); }
-   virtual int getCol() const;
-   virtual int getRow() const;
+   constexpr Position(int c, int r) :
+      colRow((r < 0 || r > 7 || c < 0 || c > 7) ? (uint8_t)0xff :
+             (uint8_t)((c << 4) | r)) {}
+   constexpr int getCol() const { return isValid() ? colRow >> 4   : -1; }
+   constexpr int getRow() const { return isValid() ? colRow & 0x0f : -1; }
    void setRow(int r);
    void setCol(int c);
-   void set(int c, int r);
+   void set(int c, int r) { *this = Position(c, r); }
 
    // Text:    The Position class can work with textual coordinates,
    //          such as "d4"
@@ -137,5 +147,9 @@ private:
    static double squareHeight;
 };
 
+static_assert(sizeof(Position) == 1, "Position is one byte");
+static_assert(std::is_trivially_copyable<Position>::value,
+              "Position must copy with memcpy");
+
 ostream& operator << (ostream& out, const Position& pos);
 istream& operator >> (istream& in, Position& pos);
@@ -0,0 +1,176 @@
+/***********************************************************************
+ * Source File:
+ *    SEARCH
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    A fixed-depth alpha-beta search over the Board
+ ************************************************************************/
+
+#include "search.h"
+#include "board.h"
+#include "movePicker.h"
+
+/***************************************************
+ * CENTER
+ * A small bonus for knights and bishops near the
+ * middle of the board, where they reach the most
+ **************************************************/
+static const int CENTER[64] =
+{
+   -20, -10, -10, -10, -10, -10, -10, -20,
+   -10,   0,   0,   5,   5,   0,   0, -10,
+   -10,   0,  10,  10,  10,  10,   0, -10,
+   -10,   5,  10,  20,  20,  10,   5, -10,
+   -10,   5,  10,  20,  20,  10,   5, -10,
+   -10,   0,  10,  10,  10,  10,   0, -10,
+   -10,   0,   0,   5,   5,   0,   0, -10,
+   -20, -10, -10, -10, -10, -10, -10, -20
+};
+
+/***************************************************
+ * SEARCH : CONSTRUCTOR
+ **************************************************/
+Search::Search(Board& board) : board(board), nodes(0), bestMove(MOVE_NONE)
+{
+   for (int ply = 0; ply < MAX_PLY; ply++)
+      killers[ply][0] = killers[ply][1] = MOVE_NONE;
+}
+
+/***************************************************
+ * SEARCH : SEARCH
+ * Search the position to a fixed depth. The nodes
+ * and killers carry on from any earlier search
+ **************************************************/
+int Search::search(int depth)
+{
+   bestMove = MOVE_NONE;
+   return alphaBeta(depth, 0, -INFINITE, INFINITE);
+}
+
+/***************************************************
+ * SEARCH : ALPHA BETA
+ * Negamax with alpha-beta cutoffs. The MovePicker
+ * hands out pseudo-legal moves best-first, so any
+ * that leave the king in check are taken back and
+ * skipped. With no legal move at all it is mate or
+ * stalemate
+ **************************************************/
+int Search::alphaBeta(int depth, int ply, int alpha, int beta)
+{
+   if (depth <= 0 || ply >= MAX_PLY - 1)
+      return quiesce(ply, alpha, beta);
+   nodes++;
+
+   bool fWhite = board.whiteTurn();
+   int numLegal = 0;
+   MovePicker picker(board, MOVE_NONE, killers[ply][0], killers[ply][1]);
+   for (MoveCode move = picker.next(); move != MOVE_NONE; move = picker.next())
+   {
+      board.makeMove(move);
+      if (inCheck(fWhite))
+      {
+         board.unmakeMove();
+         continue;
+      }
+      numLegal++;
+      int score = -alphaBeta(depth - 1, ply + 1, -beta, -alpha);
+      board.unmakeMove();
+
+      if (score > alpha)
+      {
+         alpha = score;
+         if (ply == 0)
+            bestMove = move;
+      }
+      if (alpha >= beta)
+      {
+         // remember a quiet move that refuted this position
+         if (!move.isCapture() && !move.isPromotion() && move != killers[ply][0])
+         {
+            killers[ply][1] = killers[ply][0];
+            killers[ply][0] = move;
+         }
+         return alpha;
+      }
+   }
+
+   if (numLegal == 0)
+      return inCheck(fWhite) ? -MATE + ply : 0;
+   return alpha;
+}
+
+/***************************************************
+ * SEARCH : QUIESCE
+ * At the end of the main search keep trying the
+ * captures that win material until the position is
+ * quiet, so a leaf is never scored in the middle of
+ * an exchange. Standing pat is always allowed
+ **************************************************/
+int Search::quiesce(int ply, int alpha, int beta)
+{
+   nodes++;
+   int standPat = evaluate();
+   if (standPat >= beta || ply >= MAX_PLY - 1)
+      return standPat;
+   if (standPat > alpha)
+      alpha = standPat;
+
+   bool fWhite = board.whiteTurn();
+   MovePicker picker(board);
+   picker.goodCapturesOnly();
+   for (MoveCode move = picker.next(); move != MOVE_NONE; move = picker.next())
+   {
+      board.makeMove(move);
+      if (inCheck(fWhite))
+      {
+         board.unmakeMove();
+         continue;
+      }
+      int score = -quiesce(ply + 1, -beta, -alpha);
+      board.unmakeMove();
+
+      if (score > alpha)
+         alpha = score;
+      if (alpha >= beta)
+         break;
+   }
+   return alpha;
+}
+
+/***************************************************
+ * SEARCH : EVALUATE
+ * Material, plus a little for pawns that have pushed
+ * on and for knights and bishops near the center,
+ * from the point of view of the side to move
+ **************************************************/
+int Search::evaluate() const
+{
+   int score = board.getMaterial(true) - board.getMaterial(false);
+
+   Bitboard bb = board.getPieces(true, PAWN);
+   while (bb)
+      score += 5 * (popLsb(bb) / 8 - 1);
+   bb = board.getPieces(false, PAWN);
+   while (bb)
+      score -= 5 * (6 - popLsb(bb) / 8);
+
+   bb = board.getPieces(true, KNIGHT) | board.getPieces(true, BISHOP);
+   while (bb)
+      score += CENTER[popLsb(bb)];
+   bb = board.getPieces(false, KNIGHT) | board.getPieces(false, BISHOP);
+   while (bb)
+      score -= CENTER[popLsb(bb)];
+
+   return board.whiteTurn() ? score : -score;
+}
+
+/***************************************************
+ * SEARCH : IN CHECK
+ * Is the given side's king attacked?
+ **************************************************/
+bool Search::inCheck(bool fWhite) const
+{
+   Bitboard king = board.getPieces(fWhite, KING);
+   return king != BB_EMPTY && board.isSquareAttacked(bitScan(king), !fWhite);
+}
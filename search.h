@@ -0,0 +1,53 @@
+/***********************************************************************
+ * Header File:
+ *    SEARCH
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    A fixed-depth alpha-beta search over the Board, with a capture
+ *    search at the leaves. It is deterministic: the same position and
+ *    depth always visit the same nodes, which is what makes the node
+ *    count of "bench" a signature of the search
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include "moveCode.h"
+
+class Board;
+class TestSearch;
+
+/***************************************************
+ * SEARCH
+ * Scores are in centipawns from the point of view of
+ * the side to move. A mate is worth MATE less the
+ * number of plies it takes
+ **************************************************/
+class Search
+{
+   friend TestSearch;
+public:
+   static const int INFINITE = 32000;
+   static const int MATE     = 30000;
+   static const int MAX_PLY  = 64;
+
+   Search(Board& board);
+
+   // look depth plies ahead, returning the score of the position
+   int search(int depth);
+
+   MoveCode getBestMove() const { return bestMove; }
+   uint64_t getNodes()    const { return nodes;    }
+
+private:
+   int  alphaBeta(int depth, int ply, int alpha, int beta);
+   int  quiesce(int ply, int alpha, int beta);
+   int  evaluate() const;
+   bool inCheck(bool fWhite) const;
+
+   Board&   board;
+   uint64_t nodes;                    // every position searched
+   MoveCode bestMove;                 // at the root
+   MoveCode killers[MAX_PLY][2];      // quiet moves that caused a cutoff
+};
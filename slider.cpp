@@ -0,0 +1,218 @@
+/***********************************************************************
+ * Source File:
+ *    SLIDER
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    Builds the magic-bitboard tables for the sliding pieces
+ ************************************************************************/
+
+#include "slider.h"
+#include "cpu.h"       // for cpuHasFastPext() and cpuHasAvx2()
+
+SliderBackend sliderBackend = SLIDER_MAGIC;
+SliderSetAttacks sliderSetAttacks = sliderSetAttacksScalar;
+Magic ROOK_MAGICS[64];
+Magic BISHOP_MAGICS[64];
+Bitboard BETWEEN[64][64];
+Bitboard LINE[64][64];
+
+// every blocker subset of every square, 800KB for the rooks and 41KB
+// for the bishops
+static Bitboard rookTable[0x19000];
+static Bitboard bishopTable[0x1480];
+
+/***************************************************
+ * SLIDE ATTACKS
+ * Walk each ray until we run off the board or into
+ * a piece. Slow, so it is only used to fill the tables
+ **************************************************/
+Bitboard slideAttacks(int location, Bitboard occupied, bool fRook)
+{
+   static const int rookDeltas[4][2]   = { { 0, 1 }, { 1, 0 }, { 0, -1 }, { -1, 0 } };
+   static const int bishopDeltas[4][2] = { { 1, 1 }, { 1, -1 }, { -1, -1 }, { -1, 1 } };
+   const int (*deltas)[2] = fRook ? rookDeltas : bishopDeltas;
+
+   Bitboard attacks = BB_EMPTY;
+   for (int i = 0; i < 4; i++)
+   {
+      int c = location % 8 + deltas[i][0];
+      int r = location / 8 + deltas[i][1];
+      while (0 <= c && c < 8 && 0 <= r && r < 8)
+      {
+         attacks |= squareBit(c, r);
+         if (occupied & squareBit(c, r))
+            break;
+         c += deltas[i][0];
+         r += deltas[i][1];
+      }
+   }
+   return attacks;
+}
+
+/***************************************************
+ * MAGIC NUMBERS
+ * Found once with a seeded search over sparse random
+ * numbers. Each one sends every blocker subset of its
+ * square to a slot that holds the right attack set
+ **************************************************/
+static const Bitboard ROOK_MAGIC_NUMBERS[64] =
+{
+   0x0080009c20400280ULL, 0x0840004020001000ULL, 0x0680081000200080ULL, 0x0200040a00104020ULL,
+   0x5a80040002480080ULL, 0x0500040028010022ULL, 0x0480010000800200ULL, 0x5980034180002100ULL,
+   0x0800800040008020ULL, 0x2201400020100042ULL, 0x302c802000100080ULL, 0x0102800801100080ULL,
+   0x0088808004000800ULL, 0x1040808004000200ULL, 0x8004000482181110ULL, 0x304d000a00a44100ULL,
+   0x00800240002002c0ULL, 0x0010024004402000ULL, 0x0020018020801000ULL, 0x0020808008001000ULL,
+   0x0010818028000400ULL, 0x05c0808004000200ULL, 0x8a00040001100248ULL, 0x00022200010680c4ULL,
+   0x8540800080204008ULL, 0x0000210100400080ULL, 0xc060010100182040ULL, 0x0002004200100820ULL,
+   0x1000040080080080ULL, 0x0066000200041009ULL, 0x8014020400715038ULL, 0x00a00c0200214285ULL,
+   0x8080204000800080ULL, 0x1810201000404000ULL, 0x0020200080801000ULL, 0x0010200a02004010ULL,
+   0xc088100501000800ULL, 0x0006000280800400ULL, 0x0800411024000288ULL, 0x2001008046000524ULL,
+   0x0a40008000408022ULL, 0x8000200450024004ULL, 0x0030040028002000ULL, 0x0401041001090020ULL,
+   0x0024008040080800ULL, 0x24a0040002008080ULL, 0x0008080102040050ULL, 0x0010404891120004ULL,
+   0x4001004080002900ULL, 0x411020408e010200ULL, 0x920a804020120200ULL, 0x0000400810220200ULL,
+   0x4041080004008280ULL, 0x108b000400020900ULL, 0x0200529908100400ULL, 0x0224110044008200ULL,
+   0x0100210010408001ULL, 0x020041002a001082ULL, 0x0201021408402001ULL, 0x0080200409001001ULL,
+   0x4811001004020801ULL, 0x0005000400020801ULL, 0x828900c201100824ULL, 0x0104004021041082ULL
+};
+
+static const Bitboard BISHOP_MAGIC_NUMBERS[64] =
+{
+   0x40822004440941c0ULL, 0x0808500110410000ULL, 0x008401020a000200ULL, 0x420404218a0202c0ULL,
+   0x0004042060010212ULL, 0x000608120a000c00ULL, 0x080104306c042c00ULL, 0x0800420080a01020ULL,
+   0x0200041002180104ULL, 0x4804045002020022ULL, 0x0300104112002004ULL, 0xc400090405004806ULL,
+   0x0040420210020800ULL, 0x261212013008a208ULL, 0x0100040c01a80840ULL, 0x0010082908021001ULL,
+   0x0040001084884080ULL, 0x0002095110020080ULL, 0x81040102180a0109ULL, 0x2218026c01242180ULL,
+   0x0404000083a03000ULL, 0x0206009040422044ULL, 0x0850400101082000ULL, 0x20048a4044040100ULL,
+   0x82024000a0080240ULL, 0x2101100084300201ULL, 0x2101208004080680ULL, 0xa140480004820040ULL,
+   0x0019080403004004ULL, 0x2001020084104400ULL, 0x000c040002820160ULL, 0x0b04024802220204ULL,
+   0x0204044040045008ULL, 0x0142011028200202ULL, 0x0002005000010100ULL, 0x0018c008200a0200ULL,
+   0x4024040400a01100ULL, 0x0001450201010800ULL, 0x8c16008401031410ULL, 0x8048004044a48204ULL,
+   0x8102100288002090ULL, 0x404201108220b831ULL, 0x8009202030000808ULL, 0x0000044010420200ULL,
+   0xf000881014004040ULL, 0x6c20040082006020ULL, 0x0008488524200620ULL, 0xc010210200800820ULL,
+   0x00004108a0100002ULL, 0x2080411088a00001ULL, 0x0a00860042081052ULL, 0x0800008020880100ULL,
+   0x0004100420820000ULL, 0x800aa02102008200ULL, 0x4004080821041020ULL, 0x1020010202244403ULL,
+   0x2000250800900820ULL, 0x2400069145082008ULL, 0x802000c44a08040cULL, 0x0010008000840420ULL,
+   0x00800000a0043403ULL, 0x2800000404082200ULL, 0xa9c0080230042100ULL, 0x0010024288038d00ULL
+};
+
+/***************************************************
+ * LOOKUP
+ * One slider's attacks from one backend's index
+ **************************************************/
+template <SliderBackend B, const Magic* MAGICS>
+static Bitboard lookup(int location, Bitboard occupied)
+{
+   assert(0 <= location && location < 64);
+   const Magic& m = MAGICS[location];
+   return m.attacks[B == SLIDER_PEXT ? m.pextIndex(occupied) : m.magicIndex(occupied)];
+}
+
+SliderAttacks rookAttacks   = lookup<SLIDER_MAGIC, ROOK_MAGICS>;
+SliderAttacks bishopAttacks = lookup<SLIDER_MAGIC, BISHOP_MAGICS>;
+
+/***************************************************
+ * INIT MAGICS
+ * Work out the mask of each square, then walk every
+ * subset of it (carry-rippler) and file its attack set
+ **************************************************/
+static void initMagics(Magic magics[], Bitboard table[],
+                       const Bitboard numbers[], bool fRook,
+                       SliderBackend backend)
+{
+   Bitboard* next = table;
+
+   for (int location = 0; location < 64; location++)
+   {
+      Magic& m = magics[location];
+
+      // the edges never block anything, unless we are on them
+      Bitboard edges = ((BB_RANK_1 | BB_RANK_8) & ~(BB_RANK_1 << (location / 8 * 8))) |
+                       ((BB_FILE_A | BB_FILE_H) & ~(BB_FILE_A << (location % 8)));
+      m.mask    = slideAttacks(location, BB_EMPTY, fRook) & ~edges;
+      m.magic   = numbers[location];
+      m.shift   = 64 - popCount(m.mask);
+      m.attacks = next;
+      next += 1ULL << popCount(m.mask);
+
+      Bitboard subset = BB_EMPTY;
+      do
+      {
+         unsigned index = (backend == SLIDER_PEXT) ? m.pextIndex(subset) : m.magicIndex(subset);
+         m.attacks[index] = slideAttacks(location, subset, fRook);
+         subset = (subset - m.mask) & m.mask;
+      }
+      while (subset);
+   }
+}
+
+/***************************************************
+ * INIT LINES
+ * Two squares line up when each sees the other on an
+ * empty board. What both see on an empty board is then
+ * the rest of their line, and what both see with the
+ * other one blocking is what lies between
+ **************************************************/
+static void initLines()
+{
+   for (int a = 0; a < 64; a++)
+      for (int b = 0; b < 64; b++)
+      {
+         BETWEEN[a][b] = LINE[a][b] = BB_EMPTY;
+         for (int i = 0; i < 2; i++)
+         {
+            bool fRook = (i == 0);
+            if (!(slideAttacks(a, BB_EMPTY, fRook) & squareBit(b)))
+               continue;
+            LINE[a][b]    = (slideAttacks(a, BB_EMPTY, fRook) &
+                             slideAttacks(b, BB_EMPTY, fRook)) |
+                            squareBit(a) | squareBit(b);
+            BETWEEN[a][b] = slideAttacks(a, squareBit(b), fRook) &
+                            slideAttacks(b, squareBit(a), fRook);
+         }
+      }
+}
+
+/***************************************************
+ * SET SLIDER BACKEND
+ * Switch how the tables are indexed and refill them to
+ * match. Returns false, and changes nothing, if the CPU
+ * cannot run the one asked for
+ **************************************************/
+bool setSliderBackend(SliderBackend backend)
+{
+   if (backend == SLIDER_PEXT && !cpuHasFastPext())
+      return false;
+
+   sliderBackend = backend;
+   initMagics(ROOK_MAGICS,   rookTable,   ROOK_MAGIC_NUMBERS,   true  /*fRook*/, backend);
+   initMagics(BISHOP_MAGICS, bishopTable, BISHOP_MAGIC_NUMBERS, false /*fRook*/, backend);
+   if (backend == SLIDER_PEXT)
+   {
+      rookAttacks   = lookup<SLIDER_PEXT, ROOK_MAGICS>;
+      bishopAttacks = lookup<SLIDER_PEXT, BISHOP_MAGICS>;
+   }
+   else
+   {
+      rookAttacks   = lookup<SLIDER_MAGIC, ROOK_MAGICS>;
+      bishopAttacks = lookup<SLIDER_MAGIC, BISHOP_MAGICS>;
+   }
+   return true;
+}
+
+/***************************************************
+ * SLIDER INIT
+ * Fill the tables before main() so the lookups never
+ * have to check whether they are ready
+ **************************************************/
+static struct SliderInit
+{
+   SliderInit()
+   {
+      if (!setSliderBackend(SLIDER_PEXT))
+         setSliderBackend(SLIDER_MAGIC);
+      if (cpuHasAvx2())
+         sliderSetAttacks = sliderSetAttacksAvx2;
+      initLines();
+   }
+} sliderInit;
@@ -0,0 +1,135 @@
+/***********************************************************************
+ * Header File:
+ *    SLIDER
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    Attack sets for the sliding pieces (rook, bishop and queen) from
+ *    magic-bitboard tables. Only the squares that could block a slider
+ *    matter, so those bits of the occupancy are multiplied by a "magic"
+ *    number that packs them into the top bits, and that becomes the
+ *    index into a table of precomputed attack sets. On CPUs with a fast
+ *    BMI2 PEXT instruction the bits are packed by PEXT instead
+ ************************************************************************/
+
+#pragma once
+
+#include "bitboard.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h> // for _pext_u64
+#endif
+
+/***************************************************
+ * SLIDER BACKEND
+ * How the blocker bits become a table index. Picked
+ * once at startup from what the CPU supports
+ **************************************************/
+enum SliderBackend { SLIDER_MAGIC, SLIDER_PEXT };
+
+extern SliderBackend sliderBackend;   // the one the tables are filled for
+
+bool setSliderBackend(SliderBackend backend);
+
+/***************************************************
+ * PEXT
+ * Gather the bits of bb under mask into the low bits.
+ * Only used once cpuHasFastPext() said yes; the loop
+ * just keeps other compilers building
+ **************************************************/
+inline Bitboard pext(Bitboard bb, Bitboard mask)
+{
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+   // inline assembly so the rest of the file need not be built for BMI2
+   Bitboard result;
+   __asm__("pextq %2, %1, %0" : "=r"(result) : "r"(bb), "r"(mask));
+   return result;
+#elif defined(_MSC_VER) && defined(_M_X64)
+   return _pext_u64(bb, mask);
+#else
+   Bitboard result = BB_EMPTY;
+   for (Bitboard bit = 1; mask; bit <<= 1)
+   {
+      if (bb & mask & (0 - mask))
+         result |= bit;
+      mask &= mask - 1;
+   }
+   return result;
+#endif
+}
+
+/***************************************************
+ * MAGIC
+ * Everything needed to look up one slider on one square
+ **************************************************/
+struct Magic
+{
+   Bitboard  mask;       // squares that could block, edges excluded
+   Bitboard  magic;      // multiplier that packs the mask bits together
+   Bitboard* attacks;    // this square's slice of the attack table
+   int       shift;      // 64 - number of bits in the mask
+
+   unsigned magicIndex(Bitboard occupied) const
+   {
+      return (unsigned)(((occupied & mask) * magic) >> shift);
+   }
+   unsigned pextIndex(Bitboard occupied) const
+   {
+      return (unsigned)pext(occupied, mask);
+   }
+};
+
+extern Magic ROOK_MAGICS[64];
+extern Magic BISHOP_MAGICS[64];
+
+/***************************************************
+ * ROOK ATTACKS and BISHOP ATTACKS
+ * Every square a slider on location sees, the first
+ * blocker in each direction included. They point at
+ * the lookup for the backend the tables were filled
+ * for, so no lookup has to ask which one that is
+ **************************************************/
+typedef Bitboard (*SliderAttacks)(int location, Bitboard occupied);
+
+extern SliderAttacks rookAttacks;
+extern SliderAttacks bishopAttacks;
+
+/***************************************************
+ * QUEEN ATTACKS
+ **************************************************/
+inline Bitboard queenAttacks(int location, Bitboard occupied)
+{
+   return rookAttacks(location, occupied) | bishopAttacks(location, occupied);
+}
+
+// the slow ray walk the tables are built from
+Bitboard slideAttacks(int location, Bitboard occupied, bool fRook);
+
+/***************************************************
+ * BETWEEN and LINE
+ * For two squares on one rank, file or diagonal:
+ * BETWEEN is the squares strictly between them and
+ * LINE is the whole line through both, edge to edge.
+ * Both are empty when the squares do not line up
+ **************************************************/
+extern Bitboard BETWEEN[64][64];
+extern Bitboard LINE[64][64];
+
+/***************************************************
+ * SLIDER ATTACKS (set-wise)
+ * Every square attacked by a whole set of sliders at
+ * once: rooks and queens along the ranks and files,
+ * bishops and queens along the diagonals. This is a
+ * Kogge-Stone fill in all eight directions. It points at
+ * the AVX2 kernel when the CPU has one and at the plain
+ * 64-bit kernel otherwise
+ **************************************************/
+typedef Bitboard (*SliderSetAttacks)(Bitboard rookQueens, Bitboard bishopQueens,
+                                     Bitboard occupied);
+
+extern SliderSetAttacks sliderSetAttacks;
+
+Bitboard sliderSetAttacksScalar(Bitboard rookQueens, Bitboard bishopQueens,
+                                Bitboard occupied);
+Bitboard sliderSetAttacksAvx2(Bitboard rookQueens, Bitboard bishopQueens,
+                              Bitboard occupied);
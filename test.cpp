@@ -19,6 +19,8 @@
 #include "testQueen.h"
 #include "testKing.h"
 #include "testPawn.h"
+#include "testMovePicker.h"
+#include "testSearch.h"
 
 // This code, and the similar IF_DEF in testRunner(), is to ensure that
 // you can see the text output (called the console window) and OpenGL's
@@ -64,4 +66,6 @@ void testRunner()
    TestQueen().run();
    TestKing().run();
    TestPawn().run();
+   TestMovePicker().run();
+   TestSearch().run();
 }
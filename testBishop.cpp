@@ -43,6 +43,7 @@ void TestBishop::getMoves_blocked()
    board.board[1][0] = board.board[1][2] = 
    board.board[3][0] = board.board[3][2] = &white; 
    set<Move> moves;
+   board.placePieces();
 
    // EXERCISE
    bishop.getMoves(moves, board);
@@ -95,6 +96,7 @@ void TestBishop::getMoves_slideToEnd()
    c2f5.dest.colRow = 0x54;
    c2g6.dest.colRow = 0x65;
    c2h7.dest.colRow = 0x76;
+   board.placePieces();
 
    // EXERCISE
    bishop.getMoves(moves, board);
@@ -152,6 +154,7 @@ void TestBishop::getMoves_slideToBlock()
    c2e4.dest.colRow = 0x43;
    c2f5.dest.colRow = 0x54; 
    c2g6.dest.colRow = 0x65;
+   board.placePieces();
 
    // EXERCISE
    bishop.getMoves(moves, board);
@@ -207,6 +210,7 @@ void TestBishop::getMoves_slideToCapture()
    c2e4.dest.colRow = 0x43;
    c2f5.dest.colRow = 0x54;
    c2g6.dest.colRow = 0x65;
+   board.placePieces();
 
    // EXERCISE
    bishop.getMoves(moves, board);
@@ -12,7 +12,10 @@
 #include "position.h"
 #include "piece.h"
 #include "board.h"
+#include "leaper.h"
+#include "perftTable.h"
 #include <cassert>
+#include <cstring>
 
 
  /***********************************************
@@ -317,8 +320,7 @@ void TestBoard::whiteTurn_middleBlack()
 class Position00 : public Position
 {
 public:
-   int getRow() const { return 0; }
-   int getCol() const { return 0; }
+   Position00() : Position(0, 0) {}
 };
 
 /***********************************************
@@ -373,8 +375,7 @@ void TestBoard::set_a1()
 class Position77 : public Position
 {
 public:
-   int getRow() const { return 7; }
-   int getCol() const { return 7; }
+   Position77() : Position(7, 7) {}
 };
 
 /***********************************************
@@ -429,8 +430,7 @@ void TestBoard::set_h8()
 class Position07 : public Position
 {
 public:
-   int getRow() const { return 7; }
-   int getCol() const { return 0; }
+   Position07() : Position(0, 7) {}
 };
 
 /***********************************************
@@ -464,24 +464,1059 @@ void TestBoard::fetch_a8()
    board.board[0][7] = pSave;
 }
 
+/***********************************************
+ * GENERATE MOVES : two knights can both reach e7,
+ *                  and both moves must be listed
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8     .  (n)          8
+ * 7   .       .         7
+ * 6      (n)    .   .   6
+ * 5   .       .         5
+ * 4     .   .           4
+ * 3       N             3
+ * 2                     2
+ * 1                 N   1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::generateMoves_sameDestination()
+{  // SETUP
+   Board board;
+   board.move(Move("b8c6"));
+   board.move(Move("b1c3"));
+   MoveList moves;
+
+   // EXERCISE
+   board.generateMoves(moves);
+
+   // VERIFY
+   assertUnit(moves.size() == 11);
+   assertUnit(moves.contains(MoveCode(42, 52)));   // c6e7
+   assertUnit(moves.contains(MoveCode(62, 52)));   // g8e7
+   assertUnit(set<MoveCode>(moves.begin(), moves.end()).size() == 11);
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * GENERATE MOVES : black pawns push down the board
+ *                  and take diagonally, and the one
+ *                  on the a-file does not wrap to h5
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8                     8
+ * 7   P       P     P   7
+ * 6   .     n .   p .   6
+ * 5   .       .     n   5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1                     1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::generateMoves_blackPawns()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.addPiece(39, pieceCode(KNIGHT, true));
+   board.addPiece(43, pieceCode(KNIGHT, true));
+   board.addPiece(46, pieceCode(PAWN,   true));
+   board.addPiece(48, pieceCode(PAWN,   false));
+   board.addPiece(52, pieceCode(PAWN,   false));
+   board.addPiece(55, pieceCode(PAWN,   false));
+   board.numMoves = 1;
+   MoveList moves;
+
+   // EXERCISE
+   board.generateMoves(moves);
+
+   // VERIFY
+   assertUnit(moves.size() == 7);
+   assertUnit(moves.contains(MoveCode(48, 40)));                    // a7a6
+   assertUnit(moves.contains(MoveCode(48, 32)));                    // a7a5
+   assertUnit(moves.contains(MoveCode(52, 44)));                    // e7e6
+   assertUnit(moves.contains(MoveCode(52, 36)));                    // e7e5
+   assertUnit(moves.contains(MoveCode(52, 43, MoveCode::CAPTURE))); // e7xd6
+   assertUnit(moves.contains(MoveCode(55, 47)));                    // h7h6
+   assertUnit(moves.contains(MoveCode(55, 46, MoveCode::CAPTURE))); // h7xg6
+   assertUnit(!moves.contains(MoveCode(48, 39, MoveCode::CAPTURE)));// a7xh5
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * GENERATE LEGAL MOVES : the rook on e2 is pinned
+ *                        and may only slide up the file
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8           R     K   8
+ * 7           .         7
+ * 6           .         6
+ * 5           .         5
+ * 4           .         4
+ * 3           .         3
+ * 2         .(r).       2
+ * 1         . k .       1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::generateLegalMoves_pinned()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.addPiece(4,  pieceCode(KING, true));
+   board.addPiece(12, pieceCode(ROOK, true));
+   board.addPiece(60, pieceCode(ROOK, false));
+   board.addPiece(63, pieceCode(KING, false));
+   board.buildViews();
+   MoveList moves;
+
+   // EXERCISE
+   board.generateLegalMoves(moves);
+
+   // VERIFY
+   assertUnit(moves.size() == 10);
+   assertUnit(moves.contains(MoveCode(12, 20)));                    // e2e3
+   assertUnit(moves.contains(MoveCode(12, 60, MoveCode::CAPTURE))); // e2e8
+   assertUnit(!moves.contains(MoveCode(12, 11)));                   // e2d2
+   assertUnit(!moves.contains(MoveCode(12, 13)));                   // e2f2
+   assertUnit(moves.contains(MoveCode(4, 13)));                     // e1f2
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * GENERATE LEGAL MOVES : the rook on e8 gives check,
+ *                        so block it, take it, or step aside
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8           R     K   8
+ * 7                     7
+ * 6                     6
+ * 5     b               5
+ * 4           .         4
+ * 3       n             3
+ * 2         . . .       2
+ * 1         .(k).       1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::generateLegalMoves_check()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.addPiece(4,  pieceCode(KING,   true));
+   board.addPiece(18, pieceCode(KNIGHT, true));
+   board.addPiece(33, pieceCode(BISHOP, true));
+   board.addPiece(60, pieceCode(ROOK,   false));
+   board.addPiece(63, pieceCode(KING,   false));
+   board.buildViews();
+   MoveList moves;
+
+   // EXERCISE
+   board.generateLegalMoves(moves);
+
+   // VERIFY
+   assertUnit(moves.size() == 8);
+   assertUnit(moves.contains(MoveCode(18, 12)));                    // c3e2
+   assertUnit(moves.contains(MoveCode(18, 28)));                    // c3e4
+   assertUnit(moves.contains(MoveCode(33, 12)));                    // b5e2
+   assertUnit(moves.contains(MoveCode(33, 60, MoveCode::CAPTURE))); // b5e8
+   assertUnit(!moves.contains(MoveCode(4, 12)));                    // e1e2
+   assertUnit(!moves.contains(MoveCode(18, 33)));                   // c3b5
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * GENERATE LEGAL MOVES : the rook and the knight both
+ *                        give check, so only the king moves,
+ *                        and not to e2 behind itself
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8           R     K   8
+ * 7                     7
+ * 6                     6
+ * 5                     5
+ * 4                     4
+ * 3   r     N           3
+ * 2         .           2
+ * 1         .(k).       1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::generateLegalMoves_doubleCheck()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.addPiece(4,  pieceCode(KING,   true));
+   board.addPiece(16, pieceCode(ROOK,   true));
+   board.addPiece(19, pieceCode(KNIGHT, false));
+   board.addPiece(60, pieceCode(ROOK,   false));
+   board.addPiece(63, pieceCode(KING,   false));
+   board.buildViews();
+   MoveList moves;
+
+   // EXERCISE
+   board.generateLegalMoves(moves);
+
+   // VERIFY
+   assertUnit(moves.size() == 3);
+   assertUnit(moves.contains(MoveCode(4, 3)));    // e1d1
+   assertUnit(moves.contains(MoveCode(4, 11)));   // e1d2
+   assertUnit(moves.contains(MoveCode(4, 5)));    // e1f1
+
+   // TEARDOWN
+   board.free();
+}
+
 void TestBoard::set_a8()
 {  // setup
    Board board;
-   PieceDummy piece;
-   piece.fWhite = true;
-   Piece* pSave = board.board[0][7];
-   board.board[0][7] = &piece;
-   Position07 pos;
-   Piece* p = nullptr;
-   // exercise
-   board[pos].fWhite = false;
-   // verify
-   assertUnit(piece.fWhite == false);
-   assertUnit(board.board[0][7]->fWhite == false);
-   // teardown 
-   board.board[0][7] = pSave;
+   PieceDummy piece;
+   piece.fWhite = true;
+   Piece* pSave = board.board[0][7];
+   board.board[0][7] = &piece;
+   Position07 pos;
+   Piece* p = nullptr;
+   // exercise
+   board[pos].fWhite = false;
+   // verify
+   assertUnit(piece.fWhite == false);
+   assertUnit(board.board[0][7]->fWhite == false);
+   // teardown 
+   board.board[0][7] = pSave;
+}
+
+
+/***********************************************
+ * BITBOARDS : reset
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8     n         n     8
+ * 7                     7
+ * 6                     6
+ * 5                     5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1     N         N     1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::bitboards_reset()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+
+   // EXERCISE
+   board.reset();
+
+   // VERIFY
+   assertUnit(board.bbPieces[KNIGHT] == 0x4200000000000042ULL);
+   assertUnit(board.bbColors[WHITE]  == 0x4200000000000000ULL);
+   assertUnit(board.bbColors[BLACK]  == 0x0000000000000042ULL);
+   assertUnit(board.bbOccupied       == 0x4200000000000042ULL);
+   assertUnit(board.bbPieces[PAWN]   == BB_EMPTY);
+   assertUnit(board.getPieceType(1)  == KNIGHT);
+   assertUnit(board.getPieceType(2)  == SPACE);
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * BITBOARDS : move b1c3
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ * |                     |       |                     |
+ * 8     n         n     8       8     n         n     8
+ * 7                     7       7                     7
+ * 6                     6       6                     6
+ * 5                     5       5                     5
+ * 4                     4  -->  4                     4
+ * 3       .             3       3       N             3
+ * 2                     2       2                     2
+ * 1    (N)        N     1       1     .         N     1
+ * |                     |       |                     |
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::bitboards_move()
+{  // SETUP
+   Move b1c3;
+   b1c3.source.colRow = 0x10;
+   b1c3.dest.colRow = 0x22;
+   Board board;
+
+   // EXERCISE
+   board.move(b1c3);
+
+   // VERIFY
+   assertUnit(board.bbPieces[KNIGHT] == 0x4200000000040040ULL);
+   assertUnit(board.bbColors[WHITE]  == 0x4200000000000000ULL);
+   assertUnit(board.bbColors[BLACK]  == 0x0000000000040040ULL);
+   assertUnit(board.bbOccupied       == 0x4200000000040040ULL);
+   assertUnit(board.getPieceType(18) == KNIGHT);
+   assertUnit(board.getPieceType(1)  == SPACE);
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * BITBOARDS : capture e5c6r
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ * |                     |       |                     |
+ * 8                     8       8                     8
+ * 7                     7       7                     7
+ * 6       R             6       6       n             6
+ * 5          (n)        5       5           .         5
+ * 4                     4  -->  4                     4
+ * 3                     3       3                     3
+ * 2                     2       2                     2
+ * 1                     1       1                     1
+ * |                     |       |                     |
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::bitboards_capture()
+{  // SETUP
+   Move e5c6r;
+   e5c6r.source.colRow = 0x44;
+   e5c6r.dest.colRow = 0x25;
+   e5c6r.capture = ROOK;
+   Board board(nullptr, true /*noreset*/);
+   board.addPiece(36, pieceCode(KNIGHT, true));
+   board.addPiece(42, pieceCode(ROOK, false));
+
+   // EXERCISE
+   board.makeMove(e5c6r);
+
+   // VERIFY
+   assertUnit(board.squares[42] == pieceCode(KNIGHT, true));
+   assertUnit(board.squares[36] == SPACE);
+   assertUnit(board.bbPieces[KNIGHT] == squareBit(42));
+   assertUnit(board.bbPieces[ROOK]   == BB_EMPTY);
+   assertUnit(board.bbColors[WHITE]  == squareBit(42));
+   assertUnit(board.bbColors[BLACK]  == BB_EMPTY);
+   assertUnit(board.bbOccupied       == squareBit(42));
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * BITBOARDS : slider attacks of a whole side at once
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8                 .   8
+ * 7               .     7
+ * 6             .       6
+ * 5   .       .         5
+ * 4  (P).   .           4
+ * 3   .  (b)            3
+ * 2   . .   .           2
+ * 1  (r). . . . . . .   1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::bitboards_sliderAttacks()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.addPiece(0,  pieceCode(ROOK,   true));
+   board.addPiece(18, pieceCode(BISHOP, true));
+   board.addPiece(24, pieceCode(PAWN,   false));
+   Bitboard white = BB_FULL;
+   Bitboard black = BB_FULL;
+
+   // EXERCISE
+   white = board.getSliderAttacks(true  /*fWhite*/);
+   black = board.getSliderAttacks(false /*fWhite*/);
+
+   // VERIFY
+   assertUnit(white == (0x00000000000000feULL |                          // b1-h1
+                        squareBit(8)  | squareBit(16) | squareBit(24) |  // a2-a4
+                        squareBit(0)  | squareBit(9)  |                  // a1 b2
+                        squareBit(11) | squareBit(4)  |                  // d2 e1
+                        squareBit(25) | squareBit(32) |                  // b4 a5
+                        squareBit(27) | squareBit(36) | squareBit(45) |
+                        squareBit(54) | squareBit(63)));                 // d4-h8
+   assertUnit(black == BB_EMPTY);
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * BITBOARDS : material follows a capture and
+ *             its take-back, kings not counted
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8           K         8
+ * 7                     7
+ * 6                     6
+ * 5         B           5
+ * 4                     4
+ * 3      (n)            3
+ * 2                     2
+ * 1           k         1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::bitboards_material()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.addPiece(4,  pieceCode(KING,   true));
+   board.addPiece(18, pieceCode(KNIGHT, true));
+   board.addPiece(35, pieceCode(BISHOP, false));
+   board.addPiece(60, pieceCode(KING,   false));
+   board.hash = board.computeHash();
+   int whiteBefore = board.getMaterial(true  /*fWhite*/);
+   int blackBefore = board.getMaterial(false /*fWhite*/);
+
+   // EXERCISE
+   board.makeMove(MoveCode(18, 35, MoveCode::CAPTURE));   // c3xd5
+   int whiteAfter = board.getMaterial(true  /*fWhite*/);
+   int blackAfter = board.getMaterial(false /*fWhite*/);
+   board.unmakeMove();
+
+   // VERIFY
+   assertUnit(whiteBefore == PIECE_VALUE[KNIGHT]);
+   assertUnit(blackBefore == PIECE_VALUE[BISHOP]);
+   assertUnit(whiteAfter  == PIECE_VALUE[KNIGHT]);
+   assertUnit(blackAfter  == 0);
+   assertUnit(board.getMaterial(false /*fWhite*/) == PIECE_VALUE[BISHOP]);
+   assertUnit(board.getPieces(false, BISHOP) == squareBit(35));
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * IS SQUARE ATTACKED : worked back from the square.
+ *                      The rook sees the pawn on a4
+ *                      but not past it, and the pawn
+ *                      takes toward the first rank
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8                     8
+ * 7                     7
+ * 6                     6
+ * 5                     5
+ * 4   P                 4
+ * 3   . .               3
+ * 2   .                 2
+ * 1   r                 1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::isSquareAttacked_reverse()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.addPiece(0,  pieceCode(ROOK, true));
+   board.addPiece(24, pieceCode(PAWN, false));
+
+   // EXERCISE and VERIFY
+   assertUnit(board.isSquareAttacked(16, true  /*fWhite*/) == true);   // a3
+   assertUnit(board.isSquareAttacked(24, true  /*fWhite*/) == true);   // a4
+   assertUnit(board.isSquareAttacked(32, true  /*fWhite*/) == false);  // a5
+   assertUnit(board.isSquareAttacked(17, false /*fWhite*/) == true);   // b3
+   assertUnit(board.isSquareAttacked(16, false /*fWhite*/) == false);  // a3
+   assertUnit(board.isSquareAttacked(33, false /*fWhite*/) == false);  // b5
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * IS SQUARE ATTACKED : the attack maps follow
+ *                      b8c6 and its take-back
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8    (n)        n     8
+ * 7                     7
+ * 6       .             6
+ * 5           .         5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1     N         N     1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::isSquareAttacked_attackMaps()
+{  // SETUP
+   Board board;
+   board.keepAttackMaps(true);
+   Move b8c6("b8c6");
+
+   // EXERCISE
+   bool fBefore = board.isSquareAttacked(36, true /*fWhite*/);   // e5
+   board.makeMove(b8c6);
+   bool fAfter  = board.isSquareAttacked(36, true /*fWhite*/);
+   Bitboard white = board.bbAttacks[WHITE];
+   board.unmakeMove();
+   bool fUndone = board.isSquareAttacked(36, true /*fWhite*/);
+
+   // VERIFY
+   assertUnit(fBefore == false);
+   assertUnit(fAfter  == true);
+   assertUnit(fUndone == false);
+   assertUnit(white == (knightAttacks(42) | knightAttacks(62)));
+   assertUnit(board.bbAttacks[WHITE] == board.getAttacks(true  /*fWhite*/));
+   assertUnit(board.bbAttacks[BLACK] == board.getAttacks(false /*fWhite*/));
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * IS SQUARE ATTACKED : the attack maps are only
+ *                      brought up to date where a
+ *                      move touched the board, and
+ *                      still match a full count after
+ *                      every move and take-back two
+ *                      plies into Kiwipete, castles,
+ *                      en passant and promotions too
+ ***********************************************/
+void TestBoard::isSquareAttacked_attackMapsKiwipete()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.setFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+   board.keepAttackMaps(true);
+   int numWrong = 0;
+   MoveList moves;
+   board.generateLegalMoves(moves);
+
+   // EXERCISE
+   for (int i = 0; i < moves.size(); i++)
+   {
+      board.makeMove(moves[i]);
+      MoveList replies;
+      board.generateLegalMoves(replies);
+      for (int j = 0; j < replies.size(); j++)
+      {
+         board.makeMove(replies[j]);
+         if (board.bbAttacks[WHITE] != board.getAttacks(true  /*fWhite*/) ||
+             board.bbAttacks[BLACK] != board.getAttacks(false /*fWhite*/))
+            numWrong++;
+         board.unmakeMove();
+      }
+      if (board.bbAttacks[WHITE] != board.getAttacks(true  /*fWhite*/) ||
+          board.bbAttacks[BLACK] != board.getAttacks(false /*fWhite*/))
+         numWrong++;
+      board.unmakeMove();
+   }
+
+   // VERIFY
+   assertUnit(moves.size() == 48);
+   assertUnit(numWrong == 0);
+   assertUnit(board.bbAttacks[WHITE] == board.getAttacks(true  /*fWhite*/));
+   assertUnit(board.bbAttacks[BLACK] == board.getAttacks(false /*fWhite*/));
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * SET FEN : the standard starting position
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8   R N B Q K B N R   8
+ * 7   P P P P P P P P   7
+ * 6                     6
+ * 5                     5
+ * 4                     4
+ * 3                     3
+ * 2   p p p p p p p p   2
+ * 1   r n b q k b n r   1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::setFEN_start()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+
+   // EXERCISE
+   bool fOK = board.setFEN(FEN_START);
+
+   // VERIFY
+   assertUnit(fOK);
+   assertUnit(board.squares[0]  == pieceCode(ROOK,  true));
+   assertUnit(board.squares[4]  == pieceCode(KING,  true));
+   assertUnit(board.squares[11] == pieceCode(PAWN,  true));
+   assertUnit(board.squares[59] == pieceCode(QUEEN, false));
+   assertUnit(board.squares[62] == pieceCode(KNIGHT, false));
+   assertUnit(board.squares[32] == SPACE);
+   assertUnit(board.getOccupied() == 0xffff00000000ffffULL);
+   assertUnit(board.whiteTurn());
+   assertUnit(board.castle == CASTLE_ALL);
+   assertUnit(board.enPassant == -1);
+   assertUnit(board.numMoves == 0);
+   assertUnit(board.hash == board.computeHash());
+   assertUnit(board.board[0][0] == nullptr);   // no views were made
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * SET FEN : read a position and write it back.
+ *           White to move just after d7d5, the
+ *           kings and rooks all still at home
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8   R       K     R   8
+ * 7                     7
+ * 6         .           6
+ * 5         P p         5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1   r       k     r   1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::setFEN_roundTrip()
+{  // SETUP
+   const char* fen = "r3k2r/8/8/3pP3/8/8/8/R3K2R w KQkq d6 0 31";
+   Board board(nullptr, true /*noreset*/);
+   char buf[FEN_MAX];
+
+   // EXERCISE
+   bool fOK = board.setFEN(fen);
+   int length = board.getFEN(buf);
+
+   // VERIFY
+   assertUnit(fOK);
+   assertUnit(string(buf) == fen);
+   assertUnit(length == (int)strlen(fen));
+   assertUnit(board.enPassant == 43);
+   assertUnit(board.numMoves == 60);
+   assertUnit(board.squares[35] == pieceCode(PAWN, false));
+   assertUnit(board.squares[36] == pieceCode(PAWN, true));
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * SET FEN : a bad FEN is turned away and the
+ *           board is left as it was
+ ***********************************************/
+void TestBoard::setFEN_invalid()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.setFEN(FEN_START);
+   uint64_t hashBefore = board.hash;
+
+   // EXERCISE
+   bool fNine   = board.setFEN("rnbqkbnr/pppppppp/9/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+   bool fRows   = board.setFEN("rnbqkbnr/pppppppp/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+   bool fLetter = board.setFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNX w KQkq - 0 1");
+   bool fKing   = board.setFEN("rnbqqbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+   bool fSide   = board.setFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR x KQkq - 0 1");
+   bool fCastle = board.setFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQxq - 0 1");
+   bool fSquare = board.setFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq e4 0 1");
+   bool fCount  = board.setFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - x 1");
+   bool fShort  = board.setFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq");
+   bool fJunk   = board.setFEN("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1x");
+   bool fPawn8  = board.setFEN("rnbqkbnP/pppppppp/8/8/8/8/PPPPPPP1/RNBQKBNR w KQkq - 0 1");
+   bool fPawn1  = board.setFEN("4k3/8/8/8/8/8/8/p3K3 w - - 0 1");
+   bool fRank   = board.setFEN("4k3/8/8/8/8/8/3P4/4K3 w - e3 0 1");
+   bool fNoPawn = board.setFEN("4k3/8/8/8/8/8/8/4K3 w - e6 0 1");
+
+   // VERIFY
+   assertUnit(!fNine);
+   assertUnit(!fRows);
+   assertUnit(!fLetter);
+   assertUnit(!fKing);
+   assertUnit(!fSide);
+   assertUnit(!fCastle);
+   assertUnit(!fSquare);
+   assertUnit(!fCount);
+   assertUnit(!fShort);
+   assertUnit(!fJunk);
+   assertUnit(!fPawn8);
+   assertUnit(!fPawn1);
+   assertUnit(!fRank);
+   assertUnit(!fNoPawn);
+   assertUnit(board.hash == hashBefore);
+   assertUnit(board.squares[4] == pieceCode(KING, true));
+   assertUnit(board.setFEN("4k3/8/8/8/8/8/8/4K3 b - -"));
+   assertUnit(!board.whiteTurn());
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * SET FEN : castle rights the kings and rooks are
+ *           not home for are dropped, so no castle
+ *           is generated from nothing
+ ***********************************************/
+void TestBoard::setFEN_castleRights()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+
+   // EXERCISE
+   bool fBare  = board.setFEN("4k3/8/8/8/8/8/8/4K3 w KQkq - 0 1");
+   int  bare   = board.castle;
+   uint64_t nodes = board.perft(2);
+   bool fRooks = board.setFEN("r3k3/8/8/8/8/8/8/4K2R w KQkq - 0 1");
+   int  rooks  = board.castle;
+
+   // VERIFY
+   assertUnit(fBare);
+   assertUnit(bare == CASTLE_NONE);
+   assertUnit(nodes == 25);
+   assertUnit(fRooks);
+   assertUnit(rooks == (CASTLE_WHITE_KING | CASTLE_BLACK_QUEEN));
+   assertUnit(board.hash == board.computeHash());
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * SET FEN : a board with views keeps the ones it
+ *           has, moved to where the pieces now are.
+ *           The white king stays home on e1 and the
+ *           white queen goes from d1 to f3
+ ***********************************************/
+void TestBoard::setFEN_views()
+{  // SETUP
+   Board board(nullptr);
+   board.setFEN(FEN_START);
+   Piece* pKing  = board.board[4][0];
+   Piece* pQueen = board.board[3][0];
+
+   // EXERCISE
+   bool fOK = board.setFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+   // VERIFY
+   assertUnit(fOK);
+   assertUnit(board.board[4][0] == pKing);
+   assertUnit(board.board[5][2] == pQueen);
+   assertUnit(pQueen->getPosition().getLocation() == 21);
+   assertUnit(board.numSpare == Board::MAX_SPARE);
+   for (int location = 0; location < 64; location++)
+   {
+      Piece* pView = board.board[location % 8][location / 8];
+      PieceCode code = board.squares[location];
+      assertUnit(pView->getType() == codeType(code));
+      assertUnit(code == SPACE || pView->isWhite() == codeWhite(code));
+      assertUnit(pView->getPosition().getLocation() == location);
+      assertUnit(!pView->isMoved());
+   }
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * PERFT : the published counts from the start,
+ *         20 then 400 then 8,902 positions
+ ***********************************************/
+void TestBoard::perft_start()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.setFEN(FEN_START);
+
+   // EXERCISE
+   uint64_t nodes1 = board.perft(1);
+   uint64_t nodes2 = board.perft(2);
+   uint64_t nodes3 = board.perft(3);
+
+   // VERIFY
+   assertUnit(nodes1 == 20);
+   assertUnit(nodes2 == 400);
+   assertUnit(nodes3 == 8902);
+   assertUnit(board.hash == board.computeHash());
+   assertUnit(board.undo.empty());
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * PERFT : "Kiwipete", full of castles, pins,
+ *         en passant and promotions. The
+ *         published counts are 48 then 2,039
+ ***********************************************/
+void TestBoard::perft_kiwipete()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.setFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+   // EXERCISE
+   uint64_t nodes1 = board.perft(1);
+   uint64_t nodes2 = board.perft(2);
+
+   // VERIFY
+   assertUnit(nodes1 == 48);
+   assertUnit(nodes2 == 2039);
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * PERFT : counting the last ply in bulk and
+ *         remembering counts in a table give
+ *         the same 97,862 for Kiwipete at depth 3,
+ *         and the table finds transpositions
+ ***********************************************/
+void TestBoard::perft_bulkAndTable()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.setFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+   PerftTable table(1 /*megabytes*/);
+
+   // EXERCISE
+   uint64_t nodesBulk  = board.perft(3, true /*fBulk*/);
+   uint64_t nodesTable = board.perft(3, true /*fBulk*/, &table);
+   uint64_t nodesAgain = board.perft(3, false /*fBulk*/, &table);
+
+   // VERIFY
+   assertUnit(nodesBulk  == 97862);
+   assertUnit(nodesTable == 97862);
+   assertUnit(nodesAgain == 97862);
+   assertUnit(table.getProbes() > 0);
+   assertUnit(table.getHits() > 0);
+   assertUnit(board.hash == board.computeHash());
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * UNMAKE MOVE : b1c3 and back again
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ * |                     |       |                     |
+ * 8     n         n     8       8     n         n     8
+ * 7                     7       7                     7
+ * 6                     6       6                     6
+ * 5                     5       5                     5
+ * 4                     4  -->  4                     4
+ * 3       .             3       3                     3
+ * 2                     2       2                     2
+ * 1    (N)        N     1       1     N         N     1
+ * |                     |       |                     |
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBoard::unmakeMove_knightMove()
+{  // SETUP
+   Move b1c3;
+   b1c3.source.colRow = 0x10;
+   b1c3.dest.colRow = 0x22;
+   Board board;
+
+   // EXERCISE
+   board.makeMove(b1c3);
+   board.unmakeMove();
+
+   // VERIFY
+   assertUnit(board.squares[1]  == pieceCode(KNIGHT, false));
+   assertUnit(board.squares[18] == SPACE);
+   assertUnit(board.numMoves == 0);
+   assertUnit(board.undo.empty());
+   assertUnit(board.bbPieces[KNIGHT] == 0x4200000000000042ULL);
+   assertUnit(board.bbColors[BLACK]  == 0x0000000000000042ULL);
+   assertUnit(board.bbOccupied       == 0x4200000000000042ULL);
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ * UNMAKE MOVE : e5c6r and back again
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ * |                     |       |                     |
+ * 8                     8       8                     8
+ * 7                     7       7                     7
+ * 6       R             6       6       R             6
+ * 5          (n)        5       5           n         5
+ * 4                     4  -->  4                     4
+ * 3                     3       3                     3
+ * 2                     2       2                     2
+ * 1                     1       1                     1
+ * |                     |       |                     |
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::unmakeMove_knightAttack()
+{  // SETUP
+   Move e5c6r;
+   e5c6r.source.colRow = 0x44;
+   e5c6r.dest.colRow = 0x25;
+   e5c6r.capture = ROOK;
+   Board board(nullptr, true /*noreset*/);
+   board.numMoves = 17;
+   board.halfMoves = 5;
+   board.addPiece(36, pieceCode(KNIGHT, true));
+   board.addPiece(42, pieceCode(ROOK, false));
+   board.hash = board.computeHash();
+
+   // EXERCISE
+   board.makeMove(e5c6r);
+   board.unmakeMove();
+
+   // VERIFY
+   assertUnit(17 == board.numMoves);
+   assertUnit(5 == board.halfMoves);
+   assertUnit(board.squares[36] == pieceCode(KNIGHT, true));
+   assertUnit(board.squares[42] == pieceCode(ROOK, false));
+   assertUnit(board.bbPieces[KNIGHT] == squareBit(36));
+   assertUnit(board.bbPieces[ROOK]   == squareBit(42));
+   assertUnit(board.bbColors[WHITE]  == squareBit(36));
+   assertUnit(board.bbColors[BLACK]  == squareBit(42));
+   assertUnit(board.bbOccupied       == (squareBit(36) | squareBit(42)));
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ * UNMAKE MOVE : e2e4 sets the en-passant square, then clears it
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ * |                     |       |                     |
+ * 8                     8       8                     8
+ * 7                     7       7                     7
+ * 6                     6       6                     6
+ * 5                     5       5                     5
+ * 4           .         4  -->  4           p         4
+ * 3                     3       3           x         3
+ * 2          (p)        2       2           .         2
+ * 1                     1       1                     1
+ * |                     |       |                     |
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::unmakeMove_pawnDouble()
+{  // SETUP
+   Move e2e4;
+   e2e4.source.colRow = 0x41;
+   e2e4.dest.colRow = 0x43;
+   Board board(nullptr, true /*noreset*/);
+   board.addPiece(12, pieceCode(PAWN, true));
+   board.halfMoves = 3;
+   int ep = -99;
+   int halfMoves = -99;
+
+   // EXERCISE
+   board.makeMove(e2e4);
+   ep = board.enPassant;
+   halfMoves = board.halfMoves;
+   board.unmakeMove();
+
+   // VERIFY
+   assertUnit(ep == 20);                 // e3
+   assertUnit(halfMoves == 0);
+   assertUnit(board.enPassant == -1);
+   assertUnit(board.halfMoves == 3);
+   assertUnit(board.bbPieces[PAWN] == squareBit(12));
+   assertUnit(board.squares[12] == pieceCode(PAWN, true));
+   assertUnit(board.squares[28] == SPACE);
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * HASH : after a reset the kept key matches one built from scratch
+ ***********************************************/
+void TestBoard::hash_reset()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+
+   // EXERCISE
+   board.reset();
+
+   // VERIFY
+   assertUnit(board.hash != 0);
+   assertUnit(board.hash == board.computeHash());
+
+   // TEARDOWN
+   board.free();
+}
+
+/********************************************************
+ * HASH : making then unmaking e2e4 gives back the same key
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ * |                     |       |                     |
+ * 8                     8       8                     8
+ * 7                     7       7                     7
+ * 6                     6       6                     6
+ * 5                     5       5                     5
+ * 4           .         4  -->  4           p         4
+ * 3                     3       3                     3
+ * 2          (p)        2       2           .         2
+ * 1                     1       1                     1
+ * |                     |       |                     |
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::hash_unmakeMove()
+{  // SETUP
+   Move e2e4("e2e4");
+   Board board(nullptr, true /*noreset*/);
+   board.addPiece(12, pieceCode(PAWN, true));
+   uint64_t before = board.hash;
+   uint64_t during = 0;
+
+   // EXERCISE
+   board.makeMove(e2e4);
+   during = board.hash;
+   board.unmakeMove();
+
+   // VERIFY
+   assertUnit(during != before);
+   assertUnit(during == (ZOBRIST.piece[pieceCode(PAWN, true)][28] ^
+                         ZOBRIST.enPassant[4] ^ ZOBRIST.side));
+   assertUnit(board.hash == before);
+
+   // TEARDOWN
+   board.free();
 }
 
+/********************************************************
+ * HASH : the same knight moves in two different orders
+ *        reach the same position, so the same key
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ * |                     |       |                     |
+ * 8    (n)       (n)    8       8                     8
+ * 7                     7       7                     7
+ * 6       .         .   6       6       n         n   6
+ * 5                     5       5                     5
+ * 4                     4  -->  4                     4
+ * 3       .         .   3       3       N         N   3
+ * 2                     2       2                     2
+ * 1    (N)       (N)    1       1                     1
+ * |                     |       |                     |
+ * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
+ ********************************************************/
+void TestBoard::hash_transposition()
+{  // SETUP
+   Board boardA(nullptr, true /*noreset*/);
+   Board boardB(nullptr, true /*noreset*/);
+   boardA.reset();
+   boardB.reset();
+
+   // EXERCISE
+   boardA.makeMove(Move("b8c6"));
+   boardA.makeMove(Move("b1c3"));
+   boardA.makeMove(Move("g8f6"));
+   boardA.makeMove(Move("g1f3"));
+   boardB.makeMove(Move("g8f6"));
+   boardB.makeMove(Move("g1f3"));
+   boardB.makeMove(Move("b8c6"));
+   boardB.makeMove(Move("b1c3"));
+
+   // VERIFY
+   assertUnit(boardA.hash == boardB.hash);
+   assertUnit(boardA.hash == boardA.computeHash());
+
+   // TEARDOWN
+   boardA.free();
+   boardB.free();
+}
 
 /***********************************************
  * CREATE DUMMY BOARD
@@ -493,6 +1528,7 @@ void TestBoard::createDummyBoard(Board& board)
    for (int r = 0; r < 8; r++)
       for (int c = 0; c < 8; c++)
       {
+         delete board.board[c][r];
          board.board[c][r] = new PieceDummy;
       }
 }
@@ -526,6 +1562,8 @@ void TestBoard::move_knightMove()
    board.board[4][4] = new PieceSpy(4, 4, true  /*isWhite*/, KNIGHT);
    board.board[2][5] = new PieceSpy(2, 5, false /*isWhite*/, SPACE);
    board.board[4][4]->nMoves = 17;
+   board.addPiece(36, pieceCode(KNIGHT, true));
+   board.hash = board.computeHash();
    PieceSpy::reset();
 
    // EXERCISE
@@ -576,6 +1614,9 @@ void TestBoard::move_knightAttack()
    board.board[4][4] = new PieceSpy(4, 4, true  /*isWhite*/, KNIGHT);
    board.board[2][5] = new PieceSpy(2, 5, false /*isWhite*/, ROOK);
    board.board[4][4]->nMoves = 17;
+   board.addPiece(36, pieceCode(KNIGHT, true));
+   board.addPiece(42, pieceCode(ROOK, false));
+   board.hash = board.computeHash();
    PieceSpy::reset();
 
    // EXERCISE
@@ -676,8 +1717,55 @@ void TestBoard::move_pawnDouble()
  * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
  ********************************************************/
 void TestBoard::move_pawnEnpassant()
-{
-   assertUnit(NOT_YET_IMPLEMENTED);
+{  // SETUP
+   Move a5b6E;
+   a5b6E.source.colRow = 0x04;
+   a5b6E.dest.colRow = 0x15;
+   a5b6E.capture = PAWN;
+   a5b6E.promote = SPACE;
+   a5b6E.isWhite = true;
+   a5b6E.enpassant = true;
+   a5b6E.moveType = Move::ENPASSANT;
+   Board board(nullptr, true /*noreset*/);
+   board.numMoves = 18;
+   board.board[0][4] = new PieceSpy(0, 4, true  /*isWhite*/, PAWN);
+   board.board[1][4] = new PieceSpy(1, 4, false /*isWhite*/, PAWN);
+   board.board[1][5] = new PieceSpy(1, 5, false /*isWhite*/, SPACE);
+   board.addPiece(32, pieceCode(PAWN, true));
+   board.addPiece(33, pieceCode(PAWN, false));
+   board.enPassant = 41;
+   board.hash = board.computeHash();
+   uint64_t hashBefore = board.hash;
+
+   // EXERCISE
+   board.move(a5b6E);
+
+   // VERIFY
+   assertUnit(19 == board.numMoves);
+   assertUnit(SPACE == (board.board[0][4])->getType());
+   assertUnit(SPACE == (board.board[1][4])->getType());
+   assertUnit(PAWN == (board.board[1][5])->getType());
+   assertUnit(board.squares[41] == pieceCode(PAWN, true));
+   assertUnit(board.squares[33] == SPACE);
+   assertUnit(board.squares[32] == SPACE);
+   assertUnit(board.getMaterial(false) == 0);
+   assertUnit(board.enPassant == -1);
+   assertUnit(board.hash == board.computeHash());
+   board.unmakeMove();
+   assertUnit(board.squares[32] == pieceCode(PAWN, true));
+   assertUnit(board.squares[33] == pieceCode(PAWN, false));
+   assertUnit(board.squares[41] == SPACE);
+   assertUnit(board.enPassant == 41);
+   assertUnit(board.hash == hashBefore);
+
+   // TEARDOWN
+   for (Piece* pCaptured : board.captured)
+      delete pCaptured;
+   board.captured.clear();
+   delete board.board[0][4];
+   delete board.board[1][4];
+   delete board.board[1][5];
+   board.board[0][4] = board.board[1][4] = board.board[1][5] = nullptr;
 }
 
 
@@ -697,8 +1785,48 @@ void TestBoard::move_pawnEnpassant()
  * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
  ********************************************************/
 void TestBoard::move_pawnPromotion()
-{
-   assertUnit(NOT_YET_IMPLEMENTED);
+{  // SETUP
+   Move a7a8Q;
+   a7a8Q.source.colRow = 0x06;
+   a7a8Q.dest.colRow = 0x07;
+   a7a8Q.capture = SPACE;
+   a7a8Q.promote = QUEEN;
+   a7a8Q.isWhite = true;
+   a7a8Q.moveType = Move::MOVE;
+   Board board(nullptr, true /*noreset*/);
+   board.numMoves = 20;
+   board.board[0][6] = new PieceSpy(0, 6, true  /*isWhite*/, PAWN);
+   board.board[0][7] = new PieceSpy(0, 7, false /*isWhite*/, SPACE);
+   board.addPiece(48, pieceCode(PAWN, true));
+   board.hash = board.computeHash();
+   uint64_t hashBefore = board.hash;
+
+   // EXERCISE
+   board.move(a7a8Q);
+
+   // VERIFY
+   assertUnit(21 == board.numMoves);
+   assertUnit(SPACE == (board.board[0][6])->getType());
+   assertUnit(QUEEN == (board.board[0][7])->getType());
+   assertUnit(board.squares[56] == pieceCode(QUEEN, true));
+   assertUnit(board.squares[48] == SPACE);
+   assertUnit(board.getPieces(true, PAWN) == BB_EMPTY);
+   assertUnit(board.getPieces(true, QUEEN) == squareBit(56));
+   assertUnit(board.getMaterial(true) == PIECE_VALUE[QUEEN]);
+   assertUnit(board.hash == board.computeHash());
+   board.unmakeMove();
+   assertUnit(board.squares[48] == pieceCode(PAWN, true));
+   assertUnit(board.squares[56] == SPACE);
+   assertUnit(board.getMaterial(true) == PIECE_VALUE[PAWN]);
+   assertUnit(board.hash == hashBefore);
+
+   // TEARDOWN
+   for (Piece* pCaptured : board.captured)
+      delete pCaptured;
+   board.captured.clear();
+   delete board.board[0][6];
+   delete board.board[0][7];
+   board.board[0][6] = board.board[0][7] = nullptr;
 }
 
 
@@ -884,8 +2012,54 @@ void TestBoard::move_kingAttack()
  * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
  ********************************************************/
 void TestBoard::move_kingShortCastle()
-{
-   assertUnit(NOT_YET_IMPLEMENTED);
+{  // SETUP
+   Move e1g1c;
+   e1g1c.source.colRow = 0x40;
+   e1g1c.dest.colRow = 0x60;
+   e1g1c.capture = SPACE;
+   e1g1c.promote = SPACE;
+   e1g1c.isWhite = true;
+   e1g1c.castleK = true;
+   e1g1c.moveType = Move::CASTLE_KING;
+   Board board(nullptr, true /*noreset*/);
+   board.numMoves = 8;
+   board.board[4][0] = new PieceSpy(4, 0, true  /*isWhite*/, KING);
+   board.board[5][0] = new PieceSpy(5, 0, false /*isWhite*/, SPACE);
+   board.board[6][0] = new PieceSpy(6, 0, false /*isWhite*/, SPACE);
+   board.board[7][0] = new PieceSpy(7, 0, true  /*isWhite*/, ROOK);
+   board.addPiece(4, pieceCode(KING, true));
+   board.addPiece(7, pieceCode(ROOK, true));
+   board.castle = CASTLE_ALL;
+   board.hash = board.computeHash();
+   uint64_t hashBefore = board.hash;
+
+   // EXERCISE
+   board.move(e1g1c);
+
+   // VERIFY
+   assertUnit(9 == board.numMoves);
+   assertUnit(SPACE == (board.board[4][0])->getType());
+   assertUnit(ROOK == (board.board[5][0])->getType());
+   assertUnit(KING == (board.board[6][0])->getType());
+   assertUnit(SPACE == (board.board[7][0])->getType());
+   assertUnit(board.squares[6] == pieceCode(KING, true));
+   assertUnit(board.squares[5] == pieceCode(ROOK, true));
+   assertUnit(board.squares[7] == SPACE);
+   assertUnit(board.squares[4] == SPACE);
+   assertUnit(board.castle == (CASTLE_BLACK_KING | CASTLE_BLACK_QUEEN));
+   assertUnit(board.hash == board.computeHash());
+   board.unmakeMove();
+   assertUnit(board.squares[4] == pieceCode(KING, true));
+   assertUnit(board.squares[7] == pieceCode(ROOK, true));
+   assertUnit(board.castle == CASTLE_ALL);
+   assertUnit(board.hash == hashBefore);
+
+   // TEARDOWN
+   for (int c = 4; c < 8; c++)
+   {
+      delete board.board[c][0];
+      board.board[c][0] = nullptr;
+   }
 }
 
 
@@ -906,8 +2080,56 @@ void TestBoard::move_kingShortCastle()
  * +---a-b-c-d-e-f-g-h---+       +---a-b-c-d-e-f-g-h---+
  ********************************************************/
 void TestBoard::move_kingLongCastle()
-{
-   assertUnit(NOT_YET_IMPLEMENTED);
+{  // SETUP
+   Move e1c1C;
+   e1c1C.source.colRow = 0x40;
+   e1c1C.dest.colRow = 0x20;
+   e1c1C.capture = SPACE;
+   e1c1C.promote = SPACE;
+   e1c1C.isWhite = true;
+   e1c1C.castleQ = true;
+   e1c1C.moveType = Move::CASTLE_QUEEN;
+   Board board(nullptr, true /*noreset*/);
+   board.numMoves = 8;
+   board.board[0][0] = new PieceSpy(0, 0, true  /*isWhite*/, ROOK);
+   board.board[1][0] = new PieceSpy(1, 0, false /*isWhite*/, SPACE);
+   board.board[2][0] = new PieceSpy(2, 0, false /*isWhite*/, SPACE);
+   board.board[3][0] = new PieceSpy(3, 0, false /*isWhite*/, SPACE);
+   board.board[4][0] = new PieceSpy(4, 0, true  /*isWhite*/, KING);
+   board.addPiece(4, pieceCode(KING, true));
+   board.addPiece(0, pieceCode(ROOK, true));
+   board.castle = CASTLE_ALL;
+   board.hash = board.computeHash();
+   uint64_t hashBefore = board.hash;
+
+   // EXERCISE
+   board.move(e1c1C);
+
+   // VERIFY
+   assertUnit(9 == board.numMoves);
+   assertUnit(SPACE == (board.board[0][0])->getType());
+   assertUnit(SPACE == (board.board[1][0])->getType());
+   assertUnit(KING == (board.board[2][0])->getType());
+   assertUnit(ROOK == (board.board[3][0])->getType());
+   assertUnit(SPACE == (board.board[4][0])->getType());
+   assertUnit(board.squares[2] == pieceCode(KING, true));
+   assertUnit(board.squares[3] == pieceCode(ROOK, true));
+   assertUnit(board.squares[0] == SPACE);
+   assertUnit(board.squares[4] == SPACE);
+   assertUnit(board.castle == (CASTLE_BLACK_KING | CASTLE_BLACK_QUEEN));
+   assertUnit(board.hash == board.computeHash());
+   board.unmakeMove();
+   assertUnit(board.squares[4] == pieceCode(KING, true));
+   assertUnit(board.squares[0] == pieceCode(ROOK, true));
+   assertUnit(board.castle == CASTLE_ALL);
+   assertUnit(board.hash == hashBefore);
+
+   // TEARDOWN
+   for (int c = 0; c < 5; c++)
+   {
+      delete board.board[c][0];
+      board.board[c][0] = nullptr;
+   }
 }
 
 
@@ -66,6 +66,47 @@ public:
       set_h8();
       set_a8();
 
+      // generate
+      generateMoves_sameDestination();
+      generateMoves_blackPawns();
+      generateLegalMoves_pinned();
+      generateLegalMoves_check();
+      generateLegalMoves_doubleCheck();
+
+      // bitboards
+      bitboards_reset();
+      bitboards_move();
+      bitboards_capture();
+      bitboards_sliderAttacks();
+      bitboards_material();
+
+      // attacked squares
+      isSquareAttacked_reverse();
+      isSquareAttacked_attackMaps();
+      isSquareAttacked_attackMapsKiwipete();
+
+      // FEN
+      setFEN_start();
+      setFEN_roundTrip();
+      setFEN_invalid();
+      setFEN_castleRights();
+      setFEN_views();
+
+      // perft
+      perft_start();
+      perft_kiwipete();
+      perft_bulkAndTable();
+
+      // make and unmake
+      unmakeMove_knightMove();
+      unmakeMove_knightAttack();
+      unmakeMove_pawnDouble();
+
+      // zobrist hash
+      hash_reset();
+      hash_unmakeMove();
+      hash_transposition();
+
       report("Board");
    }
 private:
@@ -109,5 +150,38 @@ private:
    void set_h8();
    void set_a8();
 
+   void generateMoves_sameDestination();
+   void generateMoves_blackPawns();
+   void generateLegalMoves_pinned();
+   void generateLegalMoves_check();
+   void generateLegalMoves_doubleCheck();
+
+   void bitboards_reset();
+   void bitboards_move();
+   void bitboards_capture();
+   void bitboards_sliderAttacks();
+   void bitboards_material();
+
+   void isSquareAttacked_reverse();
+   void isSquareAttacked_attackMaps();
+   void isSquareAttacked_attackMapsKiwipete();
+
+   void setFEN_start();
+   void setFEN_roundTrip();
+   void setFEN_invalid();
+   void setFEN_castleRights();
+   void setFEN_views();
+
+   void perft_start();
+   void perft_kiwipete();
+   void perft_bulkAndTable();
+
+   void unmakeMove_knightMove();
+   void unmakeMove_knightAttack();
+   void unmakeMove_pawnDouble();
+
+   void hash_reset();
+   void hash_unmakeMove();
+   void hash_transposition();
 };
 
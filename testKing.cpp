@@ -50,6 +50,7 @@ void TestKing::getMoves_blocked()
    board.board[3][5] = &white; // d6
 
    set<Move> moves;
+   board.placePieces();
 
    // EXERCISE
    king.getMoves(moves, board);
@@ -116,6 +117,7 @@ void TestKing::getMoves_capture()
    captureD5.dest.colRow = 0x34; captureD6.dest.colRow = 0x35;
 
    set<Move> moves;
+   board.placePieces();
 
    // EXERCISE
    king.getMoves(moves, board);
@@ -177,6 +179,7 @@ void TestKing::getMoves_free()
    moveToD5.dest.colRow = 0x34; moveToD6.dest.colRow = 0x35;
 
    set<Move> moves;
+   board.placePieces();
 
    // EXERCISE
    king.getMoves(moves, board);
@@ -224,6 +227,7 @@ void TestKing::getMoves_end()
    moveToA2.dest.colRow = 0x01; moveToB1.dest.colRow = 0x10; moveToB2.dest.colRow = 0x11;
 
    set<Move> moves;
+   board.placePieces();
 
    // EXERCISE
    king.getMoves(moves, board);
@@ -283,6 +287,7 @@ void TestKing::getMoves_whiteCastle()
    board.board[5][1] = &pawn3; // f2
 
    set<Move> moves;
+   board.placePieces();
 
    // EXERCISE
    king.getMoves(moves, board);
@@ -356,6 +361,7 @@ void TestKing::getMoves_blackCastle()
    board.board[4][6] = &pawn2; // e7
    board.board[5][6] = &pawn3; // f7
 
+   board.placePieces();
    set<Move> moves;
    king.getMoves(moves, board);
 
@@ -415,6 +421,7 @@ void TestKing::getMoves_whiteCastleKingMoved()
    rookQueenSide.nMoves = 0;
    board.board[0][0] = &rookQueenSide;
 
+   board.placePieces();
    set<Move> moves;
    king.getMoves(moves, board);
 
@@ -470,6 +477,7 @@ void TestKing::getMoves_whiteCastleRookMoved()
    rookQueenSide.nMoves = 1; // Rook HAS moved
    board.board[0][0] = &rookQueenSide;
 
+   board.placePieces();
    set<Move> moves;
    king.getMoves(moves, board);
 
@@ -492,6 +500,70 @@ void TestKing::getMoves_whiteCastleRookMoved()
    board.board[0][0] = nullptr;
 }
 
+/*************************************
+ * GET MOVES : white castle through check
+ * The rook on f8 sees f1, which the king
+ * would cross to castle king side
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8             R       8
+ * 7             .       7
+ * 6             .       6
+ * 5             .       5
+ * 4             .       4
+ * 3             .       3
+ * 2             .       2
+ * 1   r      (k).   r   1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ **************************************/
+void TestKing::getMoves_whiteCastleThroughCheck()
+{
+   // SETUP
+   BoardEmpty board;
+   King king(4, 0, true); // e1
+   king.nMoves = 0;
+   board.board[4][0] = &king;
+
+   Rook rookKingSide(7, 0, true); // h1
+   rookKingSide.nMoves = 0;
+   board.board[7][0] = &rookKingSide;
+
+   Rook rookQueenSide(0, 0, true); // a1
+   rookQueenSide.nMoves = 0;
+   board.board[0][0] = &rookQueenSide;
+
+   Rook rookAttacker(5, 7, false); // f8
+   board.board[5][7] = &rookAttacker;
+
+   set<Move> moves;
+   board.placePieces();
+
+   // EXERCISE
+   king.getMoves(moves, board);
+
+   // VERIFY
+   bool foundKingSideCastle = false;
+   bool foundQueenSideCastle = false;
+
+   for (const Move& move : moves)
+   {
+      if (move.getCastleK())
+         foundKingSideCastle = true;
+      if (move.getCastleQ())
+         foundQueenSideCastle = true;
+   }
+
+   assertUnit(foundKingSideCastle == false);
+   assertUnit(foundQueenSideCastle == true);
+
+   // TEARDOWN
+   board.board[4][0] = nullptr;
+   board.board[7][0] = nullptr;
+   board.board[0][0] = nullptr;
+   board.board[5][7] = nullptr;
+}
+
 /*************************************
  * GET TYPE : king
  * Input:
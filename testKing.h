@@ -32,6 +32,7 @@ public:
       getMoves_blackCastle();
       getMoves_whiteCastleKingMoved();
       getMoves_whiteCastleRookMoved();
+      getMoves_whiteCastleThroughCheck();
 
       getType();
 
@@ -46,5 +47,6 @@ private:
    void getMoves_blackCastle();
    void getMoves_whiteCastleKingMoved();
    void getMoves_whiteCastleRookMoved();
+   void getMoves_whiteCastleThroughCheck();
    void getType();
 };
@@ -46,6 +46,7 @@ void TestKnight::getMoves_end()
    g1e2p.source.colRow = g1h3.source.colRow = 0x60;
    g1e2p.dest.colRow = 0x41; g1h3.dest.colRow = 0x72;
    g1e2p.capture = PAWN; g1h3.capture = SPACE;
+   board.placePieces();
 
    // EXERCISE
    knight.getMoves(moves, board);
@@ -97,6 +98,7 @@ void TestKnight::getMoves_blocked()
    board.board[4][2] = &white; // e3
 
    set<Move> moves;
+   board.placePieces();
 
    // EXERCISE
    knight.getMoves(moves, board);
@@ -160,6 +162,7 @@ void TestKnight::getMoves_capture()
    captureB4.dest.colRow = 0x13; captureF4.dest.colRow = 0x53; captureC3.dest.colRow = 0x22; captureE3.dest.colRow = 0x42;
 
    set<Move> moves;
+   board.placePieces();
 
    // EXERCISE
    knight.getMoves(moves, board);
@@ -218,6 +221,7 @@ void TestKnight::getMoves_free()
    moveToB4.dest.colRow = 0x13; moveToF4.dest.colRow = 0x53; moveToC3.dest.colRow = 0x22; moveToE3.dest.colRow = 0x42;
 
    set<Move> moves;
+   board.placePieces();
 
    // EXERCISE
    knight.getMoves(moves, board);
@@ -11,6 +11,7 @@
 #include "testMove.h"
 #include "move.h"
 #include <cassert>
+#include <sstream>
 
  /*************************************
   * Constructor : default
@@ -202,6 +203,31 @@ void TestMove::read_castleQueen()
    assertUnit(m.castleQ == true);
 }
 
+/*************************************
+ * READ capture and promotion
+ * Input:  b7a8rQ
+ * Output: source=1,6
+ *         dest  =0,7
+ *         capture=ROOK, promote=QUEEN
+ **************************************/
+void TestMove::read_promotion()
+{
+   // Setup
+   Move m;
+   string moveText = "b7a8rQ";
+
+   // Exercise
+   m.read(moveText);
+
+   // Verify
+   assertUnit(m.source.colRow == 0x16);
+   assertUnit(m.dest.colRow == 0x07);
+   assertUnit(m.moveType == Move::MOVE);
+   assertUnit(m.capture == ROOK);
+   assertUnit(m.promote == QUEEN);
+   assertUnit(m.write() == "b7a8rQ");
+}
+
 /*************************************
  * ASSIGN simple move
  * Input:  e5e6
@@ -807,3 +833,85 @@ void TestMove::lessthan_greaterthan()
    assertUnit(result == false);
 
 }  // Teardown
+
+/*************************************
+ * GET CODE capture
+ * Input : e5e6r
+ * Output: source=36 dest=44 flags=CAPTURE
+ **************************************/
+void TestMove::getCode_capture()
+{
+   // Setup
+   Move m("e5e6r");
+
+   // Exercise
+   MoveCode code = m.getCode();
+
+   // Verify
+   assertUnit(code.getSrc() == 36);
+   assertUnit(code.getDest() == 44);
+   assertUnit(code.getFlags() == MoveCode::CAPTURE);
+   assertUnit(code.isCapture() == true);
+   assertUnit(sizeof(code) == 2);
+}  // Teardown
+
+/*************************************
+ * GET CODE king side castle
+ * Input : e1g1c
+ * Output: source=4 dest=6 flags=CASTLE_KING
+ **************************************/
+void TestMove::getCode_castleKing()
+{
+   // Setup
+   Move m("e1g1c");
+
+   // Exercise
+   MoveCode code = m.getCode();
+
+   // Verify
+   assertUnit(code.getSrc() == 4);
+   assertUnit(code.getDest() == 6);
+   assertUnit(code.getFlags() == MoveCode::CASTLE_KING);
+   assertUnit(code.isCastle() == true);
+   assertUnit(code.isCapture() == false);
+}  // Teardown
+
+/*************************************
+ * CONSTRUCT CODE en passant
+ * Input : source=36 dest=45 flags=ENPASSANT
+ * Output: e5f6E
+ **************************************/
+void TestMove::constructCode_enpassant()
+{
+   // Setup
+   MoveCode code(36, 45, MoveCode::ENPASSANT);
+
+   // Exercise
+   Move m(code, true /*isWhite*/);
+
+   // Verify
+   assertUnit(m.source.getLocation() == 36);
+   assertUnit(m.dest.getLocation() == 45);
+   assertUnit(m.enpassant == true);
+   assertUnit(m.capture == PAWN);
+   assertUnit(m.isWhite == true);
+   assertUnit(m.getCode() == code);
+}  // Teardown
+
+/*************************************
+ * INSERTION capture
+ * Input : source=36 dest=44 capture=ROOK
+ * Output: e5e6r
+ **************************************/
+void TestMove::insertion_capture()
+{
+   // Setup
+   Move m(MoveCode(36, 44, MoveCode::CAPTURE), true /*isWhite*/, ROOK);
+   std::ostringstream out;
+
+   // Exercise
+   out << m;
+
+   // Verify
+   assertUnit(out.str() == "e5e6r");
+}  // Teardown
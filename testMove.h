@@ -47,6 +47,7 @@ public:
       read_enpassant();
       read_castleKing();
       read_castleQueen();
+      read_promotion();
       constructString_simple();
       assign_simple();
       assign_capture();
@@ -59,6 +60,12 @@ public:
       getText_castleKing();
       getText_castleQueen();
 
+      // Packed 16-bit form
+      getCode_capture();
+      getCode_castleKing();
+      constructCode_enpassant();
+      insertion_capture();
+
       report("Move");
    }
 private:
@@ -88,6 +95,7 @@ private:
    void read_enpassant();
    void read_castleKing();
    void read_castleQueen();
+   void read_promotion();
    void constructString_simple();
    void assign_simple();
    void assign_capture();
@@ -100,5 +108,10 @@ private:
    void getText_castleKing();
    void getText_castleQueen();
 
+   void getCode_capture();
+   void getCode_castleKing();
+   void constructCode_enpassant();
+   void insertion_capture();
+
 
 };
@@ -0,0 +1,146 @@
+/***********************************************************************
+ * Source File:
+ *    TEST MOVE PICKER
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    The unit tests for MovePicker
+ ************************************************************************/
+
+#include "testMovePicker.h"
+#include "movePicker.h"
+#include "board.h"
+#include <set>
+using namespace std;
+
+/***********************************************
+ * SETUP STAGES
+ * The knight can win the queen, the queen can only
+ * take a defended pawn, and there are plenty of
+ * quiet moves besides
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8                     8
+ * 7                     7
+ * 6                     6
+ * 5         Q P         5
+ * 4         P           4
+ * 3       n             3
+ * 2                     2
+ * 1         q           1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestMovePicker::setupStages(Board& board)
+{
+   board.addPiece(3,  pieceCode(QUEEN,  true));
+   board.addPiece(18, pieceCode(KNIGHT, true));
+   board.addPiece(27, pieceCode(PAWN,   false));
+   board.addPiece(35, pieceCode(QUEEN,  false));
+   board.addPiece(36, pieceCode(PAWN,   false));
+   board.buildViews();
+}
+
+/***********************************************
+ * NEXT : hash move, winning capture, killer, the
+ *        other quiets, then the losing capture
+ ***********************************************/
+void TestMovePicker::next_stages()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   setupStages(board);
+   MoveCode hash(18, 33);     // c3b5
+   MoveCode killer(3, 11);    // d1d2
+   MovePicker picker(board, hash, killer);
+   MoveCode moves[64];
+   int num = 0;
+
+   // EXERCISE
+   for (MoveCode move = picker.next(); move != MOVE_NONE; move = picker.next())
+      moves[num++] = move;
+
+   // VERIFY
+   assertUnit(num == 24);
+   assertUnit(moves[0] == hash);
+   assertUnit(moves[1] == MoveCode(18, 35, MoveCode::CAPTURE));   // c3xd5
+   assertUnit(moves[2] == killer);
+   assertUnit(moves[23] == MoveCode(3, 27, MoveCode::CAPTURE));   // d1xd4
+   assertUnit(set<MoveCode>(moves, moves + num).size() == 24);
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * NEXT : the quiet moves are not generated while
+ *        there is still a capture to try
+ ***********************************************/
+void TestMovePicker::next_lazy()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   setupStages(board);
+   MovePicker picker(board);
+
+   // EXERCISE
+   MoveCode move = picker.next();
+
+   // VERIFY
+   assertUnit(move == MoveCode(18, 35, MoveCode::CAPTURE));       // c3xd5
+   assertUnit(picker.stage == MovePicker::STAGE_GOOD_CAPTURES);
+   assertUnit(picker.quiets.empty());
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * NEXT : asked for good captures only, the knight
+ *        takes the queen and nothing else comes
+ ***********************************************/
+void TestMovePicker::next_goodCapturesOnly()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   setupStages(board);
+   MovePicker picker(board);
+   picker.goodCapturesOnly();
+
+   // EXERCISE
+   MoveCode first  = picker.next();
+   MoveCode second = picker.next();
+
+   // VERIFY
+   assertUnit(first == MoveCode(18, 35, MoveCode::CAPTURE));      // c3xd5
+   assertUnit(second == MOVE_NONE);
+   assertUnit(picker.quiets.empty());
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * NEXT : every stage together is every move, and
+ *        a hash move with no piece behind it is
+ *        never handed out
+ ***********************************************/
+void TestMovePicker::next_sameAsGenerate()
+{  // SETUP
+   Board board;
+   board.move(Move("b8c6"));
+   board.move(Move("b1c3"));
+   MoveList generated;
+   board.generateMoves(generated);
+   MovePicker picker(board, MoveCode(0, 8) /*a1a2*/);
+   set<MoveCode> picked;
+   int num = 0;
+
+   // EXERCISE
+   for (MoveCode move = picker.next(); move != MOVE_NONE; move = picker.next(), num++)
+      picked.insert(move);
+
+   // VERIFY
+   assertUnit(num == 11);
+   assertUnit(picked == set<MoveCode>(generated.begin(), generated.end()));
+
+   // TEARDOWN
+   board.free();
+}
@@ -0,0 +1,39 @@
+/***********************************************************************
+ * Header File:
+ *    TEST MOVE PICKER
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    The unit tests for MovePicker
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+class Board;
+
+/***************************************************
+ * MOVE PICKER TEST
+ * Test the MovePicker class
+ ***************************************************/
+class TestMovePicker : public UnitTest
+{
+public:
+   void run()
+   {
+      next_stages();
+      next_lazy();
+      next_goodCapturesOnly();
+      next_sameAsGenerate();
+
+      report("MovePicker");
+   }
+private:
+   void setupStages(Board& board);
+
+   void next_stages();
+   void next_lazy();
+   void next_goodCapturesOnly();
+   void next_sameAsGenerate();
+};
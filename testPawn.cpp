@@ -46,6 +46,7 @@ void TestPawn::getMoves_simpleWhite()
    b4b5.source.colRow = 0x13;
    b4b5.dest.colRow = 0x14;
    b4b5.capture = SPACE;
+   board.placePieces();
 
    // EXERCISE
    pawn.getMoves(moves, board);
@@ -89,6 +90,7 @@ void TestPawn::getMoves_simpleBlack()
    b4b3.source.colRow = 0x13;
    b4b3.dest.colRow = 0x12;
    b4b3.capture = SPACE;
+   board.placePieces();
 
    // EXERCISE
    pawn.getMoves(moves, board);
@@ -134,6 +136,7 @@ void TestPawn::getMoves_initialAdvanceWhite()
    b2b4.capture = b2b3.capture = SPACE;
    b2b4.dest.colRow = 0x13;
    b2b3.dest.colRow = 0x12;
+   board.placePieces();
 
    // EXERCISE
    pawn.getMoves(moves, board);
@@ -179,6 +182,7 @@ void TestPawn::getMoves_initialAdvanceBlack()
    c7c6.capture = c7c5.capture = SPACE;
    c7c6.dest.colRow = 0x25;
    c7c5.dest.colRow = 0x24;
+   board.placePieces();
 
    // EXERCISE
    pawn.getMoves(moves, board);
@@ -227,6 +231,7 @@ void TestPawn::getMoves_captureWhite()
    b6a7p.capture = b6c7p.capture = PAWN;
    b6a7p.dest.colRow = 0x06;
    b6c7p.dest.colRow = 0x26;
+   board.placePieces();
 
    // EXERCISE
    pawn.getMoves(moves, board);
@@ -276,6 +281,7 @@ void TestPawn::getMoves_captureBlack()
    b6a5p.capture = b6c5p.capture = PAWN;
    b6a5p.dest.colRow = 0x04;
    b6c5p.dest.colRow = 0x24;
+   board.placePieces();
 
    // EXERCISE
    pawn.getMoves(moves, board);
@@ -292,13 +298,15 @@ void TestPawn::getMoves_captureBlack()
 
 /*************************************
  * GET MOVES TEST Enpassant
- * Enpassant: white b5 can capture a5 and c5. Note that b6 is blocked
+ * Enpassant: white b5 can capture a5, which just moved two squares
+ *            and so left a6 as the en-passant square. c5 moved
+ *            earlier and is safe, and b6 is blocked
  *
  * +---a-b-c-d-e-f-g-h---+
  * |                     |
  * 8                     8
  * 7                     7
- * 6   . P .             6
+ * 6   . P               6
  * 5   P(p)P             5
  * 4                     4
  * 3                     3
@@ -312,6 +320,7 @@ void TestPawn::getMoves_enpassantWhite()
    // SETUP
    BoardEmpty board;
    board.moveNumber = 1;
+   board.enPassant = 40;             // a6, behind the pawn on a5
    Pawn pawn(7, 7, false /*white*/); // we will reset all this.
    pawn.fWhite = true;
    pawn.nMoves = 99;
@@ -331,14 +340,15 @@ void TestPawn::getMoves_enpassantWhite()
    //b5a6p.moveType = b5c6p.moveType = ENPASSANT;
    b5a6p.dest.colRow = 0x05;
    b5c6p.dest.colRow = 0x25;
+   board.placePieces();
 
    // EXERCISE
    pawn.getMoves(moves, board);
 
    // VERIFY
-   assertUnit(moves.size() == 2);  // many possible moves
+   assertUnit(moves.size() == 1);
    assertUnit(moves.find(b5a6p) != moves.end());
-   assertUnit(moves.find(b5c6p) != moves.end());
+   assertUnit(moves.find(b5c6p) == moves.end());
 
    // TEARDOWN
    board.board[1][4] = board.board[0][5] = 
@@ -348,7 +358,9 @@ void TestPawn::getMoves_enpassantWhite()
 
 /*************************************
  * GET MOVES TEST Enpassant
- * Enpassant black f4 can capture e4 and g4. Note that f3 is blocked
+ * Enpassant black f4 can capture g4, which just moved two squares
+ *           and so left g3 as the en-passant square. e4 moved
+ *           earlier and is safe, and f3 is blocked
  *
  * +---a-b-c-d-e-f-g-h---+
  * |                     |
@@ -357,7 +369,7 @@ void TestPawn::getMoves_enpassantWhite()
  * 6                     6
  * 5                     5
  * 4           p(P)p     4
- * 3           . p .     3
+ * 3             p .     3
  * 2                     2
  * 1                     1
  * |                     |
@@ -368,6 +380,7 @@ void TestPawn::getMoves_enpassantBlack()
    // SETUP
    BoardEmpty board;
    board.moveNumber = 1;
+   board.enPassant = 22;             // g3, behind the pawn on g4
    Pawn pawn(7, 7, false /*white*/); // we will reset all this.
    pawn.fWhite = false;
    pawn.nMoves = 99;
@@ -385,13 +398,14 @@ void TestPawn::getMoves_enpassantBlack()
    //f4e4p.moveType = f4g4p.moveType = ENPASSANT;
    f4e4p.dest.colRow = 0x42;
    f4g4p.dest.colRow = 0x62;
+   board.placePieces();
 
    // EXERCISE
    pawn.getMoves(moves, board);
 
    // VERIFY
-   assertUnit(moves.size() == 2);  // many possible moves
-   assertUnit(moves.find(f4e4p) != moves.end());
+   assertUnit(moves.size() == 1);
+   assertUnit(moves.find(f4e4p) == moves.end());
    assertUnit(moves.find(f4g4p) != moves.end());
 
    // TEARDOWN
@@ -402,7 +416,8 @@ void TestPawn::getMoves_enpassantBlack()
 /*************************************
  * GET MOVES TEST Promotion
  * Promotion: white pawn b7 can capture two pawns: a8 and c8.
- *            It can also move into b8. All three are promoted to queen
+ *            It can also move into b8. All three promote to a
+ *            queen, rook, bishop or knight
  *
  * +---a-b-c-d-e-f-g-h---+
  * |                     |
@@ -437,15 +452,18 @@ void TestPawn::getMoves_promotionWhite()
    b7a8p.dest.colRow = 0x07;
    b7b8.dest.colRow = 0x17;
    b7c8p.dest.colRow = 0x27;
+   board.placePieces();
 
    // EXERCISE
    pawn.getMoves(moves, board);
 
    // VERIFY
-   assertUnit(moves.size() == 3);  
+   assertUnit(moves.size() == 12);  // four promotions on each square
    assertUnit(moves.find(b7a8p) != moves.end());
    assertUnit(moves.find(b7b8) != moves.end());
    assertUnit(moves.find(b7c8p) != moves.end());
+   b7b8.promote = KNIGHT;
+   assertUnit(moves.find(b7b8) != moves.end());
 
    // TEARDOWN
    board.board[1][6] = board.board[0][7] = board.board[2][7] = nullptr;
@@ -455,7 +473,8 @@ void TestPawn::getMoves_promotionWhite()
 /*************************************
  * GET MOVES TEST Promotion
  * Promotion: black pawn e2 can capture two rooks: d1 and f1.
- *            It can also move into e1. All three are promoted to queen
+ *            It can also move into e1. All three promote to a
+ *            queen, rook, bishop or knight
  *
  * +---a-b-c-d-e-f-g-h---+
  * |                     |
@@ -490,15 +509,18 @@ void TestPawn::getMoves_promotionBlack()
    e2d1p.dest.colRow = 0x30;
    e2e1.dest.colRow = 0x40;
    e2f1p.dest.colRow = 0x50;
+   board.placePieces();
 
    // EXERCISE
    pawn.getMoves(moves, board);
 
    // VERIFY
-   assertUnit(moves.size() == 3);  // many possible moves
+   assertUnit(moves.size() == 12);  // four promotions on each square
    assertUnit(moves.find(e2d1p) != moves.end());
    assertUnit(moves.find(e2e1) != moves.end());
    assertUnit(moves.find(e2f1p) != moves.end());
+   e2e1.promote = ROOK;
+   assertUnit(moves.find(e2e1) != moves.end());
 
    // TEARDOWN
    board.board[4][1] = board.board[3][0] = board.board[5][0] = nullptr;
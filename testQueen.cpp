@@ -41,6 +41,7 @@ void TestQueen::getMoves_blocked()
    board.board[2][2] = board.board[3][2] = board.board[3][1] = 
    board.board[3][0] = board.board[2][0] = &white;
    set<Move> moves;
+   board.placePieces();
 
    // EXERCISE
    queen.getMoves(moves, board);
@@ -92,6 +93,7 @@ void TestQueen::getMoves_slideToEnd()
    c2a4.capture = c2b3.capture = c2d3.capture = c2e4.capture = c2f5.capture = c2g6.capture = c2h7.capture =
       c2b1.capture = c2d1.capture = c2a2.capture = c2c8.capture = c2c7.capture = c2c6.capture = c2c5.capture =
       c2c4.capture = c2c3.capture = c2c1.capture = c2d2.capture = c2e2.capture = c2f2.capture = c2g2.capture = c2h2.capture = SPACE;
+   board.placePieces();
 
    // EXERCISE
    queen.getMoves(moves, board);
@@ -162,6 +164,7 @@ void TestQueen::getMoves_slideToBlock()
    c2f5.dest.colRow = 0x54; c2f2.dest.colRow = 0x51; c2g6.dest.colRow = 0x65; c2g2.dest.colRow = 0x61;
    c2b3.capture = c2c7.capture = c2c6.capture = c2c5.capture = c2c4.capture = c2c3.capture = c2d3.capture =
       c2d2.capture = c2e4.capture = c2e2.capture = c2f5.capture = c2f2.capture = c2g6.capture = c2g2.capture = SPACE;
+   board.placePieces();
 
    // EXERCISE
    queen.getMoves(moves, board);
@@ -232,6 +235,7 @@ void TestQueen::getMoves_slideToCapture()
    c2a4.capture = c2b3.capture = c2d3.capture = c2e4.capture = c2f5.capture = c2g6.capture = c2h7.capture =
       c2b1.capture = c2d1.capture = c2a2.capture = c2c8.capture = c2c7.capture = c2c6.capture = c2c5.capture =
       c2c4.capture = c2c3.capture = c2c1.capture = c2d2.capture = c2e2.capture = c2f2.capture = c2g2.capture = c2h2.capture = SPACE;
+   board.placePieces();
 
    // EXERCISE
    queen.getMoves(moves, board);
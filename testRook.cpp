@@ -45,6 +45,7 @@ void TestRook::getMoves_blocked()
    board.board[2][0] = &white; // c1
 
    set<Move> moves;
+   board.placePieces();
 
    // EXERCISE
    rook.getMoves(moves, board);
@@ -96,6 +97,7 @@ void TestRook::getMoves_slideToEnd()
 
    c2c8.capture = c2c7.capture = c2c6.capture = c2c5.capture = c2c4.capture = c2c3.capture = c2c1.capture =
       c2d2.capture = c2e2.capture = c2f2.capture = c2g2.capture = c2h2.capture = c2b2.capture = c2a2.capture = SPACE;
+   board.placePieces();
 
    // EXERCISE
    rook.getMoves(moves, board);
@@ -162,6 +164,7 @@ void TestRook::getMoves_slideToBlock()
 
    c2c7.capture = c2c6.capture = c2c5.capture = c2c4.capture = c2c3.capture =
       c2d2.capture = c2e2.capture = c2f2.capture = c2g2.capture = c2b2.capture = SPACE;
+   board.placePieces();
 
    // EXERCISE
    rook.getMoves(moves, board);
@@ -230,6 +233,7 @@ void TestRook::getMoves_slideToCapture()
 
    c2a2.capture = c2c8.capture = c2c1.capture = c2h2.capture = c2c7.capture = c2c6.capture = c2c5.capture =
       c2c4.capture = c2c3.capture = c2d2.capture = c2e2.capture = c2f2.capture = c2g2.capture = c2b2.capture = SPACE;
+   board.placePieces();
 
    // EXERCISE
    rook.getMoves(moves, board);
@@ -0,0 +1,138 @@
+/***********************************************************************
+ * Source File:
+ *    TEST SEARCH
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    The unit tests for Search
+ ************************************************************************/
+
+#include "testSearch.h"
+#include "search.h"
+#include "board.h"
+
+/***********************************************
+ * SEARCH : the rook mates on the back rank
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8   .           K     8
+ * 7             P P P   7
+ * 6                     6
+ * 5                     5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1  (r)          k     1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestSearch::search_mateInOne()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.setFEN("6k1/5ppp/8/8/8/8/8/R5K1 w - - 0 1");
+   Search search(board);
+
+   // EXERCISE
+   int score = search.search(2);
+
+   // VERIFY
+   assertUnit(search.getBestMove() == MoveCode(0, 56));          // a1a8
+   assertUnit(score == Search::MATE - 1);
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * SEARCH : the knight takes the queen
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8           K         8
+ * 7                     7
+ * 6                     6
+ * 5         Q           5
+ * 4                     4
+ * 3      (n)            3
+ * 2                     2
+ * 1           k         1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestSearch::search_winQueen()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.setFEN("4k3/8/8/3q4/8/2N5/8/4K3 w - - 0 1");
+   Search search(board);
+
+   // EXERCISE
+   int score = search.search(2);
+
+   // VERIFY
+   assertUnit(search.getBestMove() == MoveCode(18, 35, MoveCode::CAPTURE));   // c3xd5
+   assertUnit(score > PIECE_VALUE[KNIGHT]);
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * SEARCH : black has no move and is not in
+ *          check, so it is a draw
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8                (K)  8
+ * 7             q       7
+ * 6               k     6
+ * 5                     5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1                     1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestSearch::search_stalemate()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.setFEN("7k/5Q2/6K1/8/8/8/8/8 b - - 0 1");
+   Search search(board);
+
+   // EXERCISE
+   int score = search.search(3);
+
+   // VERIFY
+   assertUnit(score == 0);
+   assertUnit(search.getBestMove() == MOVE_NONE);
+   assertUnit(search.getNodes() == 1);
+
+   // TEARDOWN
+   board.free();
+}
+
+/***********************************************
+ * SEARCH : the same search visits the same nodes
+ *          every time and leaves the board as
+ *          it found it
+ ***********************************************/
+void TestSearch::search_deterministic()
+{  // SETUP
+   Board board(nullptr, true /*noreset*/);
+   board.setFEN("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+   uint64_t hashBefore = board.getHash();
+   Search first(board);
+   Search second(board);
+
+   // EXERCISE
+   int scoreFirst  = first.search(3);
+   int scoreSecond = second.search(3);
+
+   // VERIFY
+   assertUnit(first.getNodes() > 0);
+   assertUnit(first.getNodes() == second.getNodes());
+   assertUnit(scoreFirst == scoreSecond);
+   assertUnit(first.getBestMove() == second.getBestMove());
+   assertUnit(board.getHash() == hashBefore);
+
+   // TEARDOWN
+   board.free();
+}
@@ -0,0 +1,35 @@
+/***********************************************************************
+ * Header File:
+ *    TEST SEARCH
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    The unit tests for Search
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * SEARCH TEST
+ * Test the Search class
+ ***************************************************/
+class TestSearch : public UnitTest
+{
+public:
+   void run()
+   {
+      search_mateInOne();
+      search_winQueen();
+      search_stalemate();
+      search_deterministic();
+
+      report("Search");
+   }
+private:
+   void search_mateInOne();
+   void search_winQueen();
+   void search_stalemate();
+   void search_deterministic();
+};
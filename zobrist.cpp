@@ -0,0 +1,51 @@
+/***********************************************************************
+ * Source File:
+ *    ZOBRIST
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    The random keys that are XORed together to make a 64-bit hash of
+ *    a position
+ ************************************************************************/
+
+#include "zobrist.h"
+
+/***************************************************
+ * NEXT RANDOM
+ * xorshift64* : small, fast, and good enough for hashing
+ **************************************************/
+static constexpr uint64_t nextRandom(uint64_t& state)
+{
+   state ^= state >> 12;
+   state ^= state << 25;
+   state ^= state >> 27;
+   return state * 0x2545F4914F6CDD1DULL;
+}
+
+/***************************************************
+ * BUILD ZOBRIST
+ * Fill every key from one fixed seed
+ **************************************************/
+static constexpr ZobristKeys buildZobrist()
+{
+   ZobristKeys keys = {};
+   uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+   // the empty codes (INVALID and SPACE) keep a key of zero
+   for (int code = 0; code < 16; code++)
+      for (int location = 0; location < 64; location++)
+         keys.piece[code][location] = (codeType((PieceCode)code) > SPACE) ?
+                                      nextRandom(state) : 0;
+
+   // no rights at all hashes to zero as well
+   for (int rights = 1; rights < 16; rights++)
+      keys.castle[rights] = nextRandom(state);
+
+   for (int file = 0; file < 8; file++)
+      keys.enPassant[file] = nextRandom(state);
+
+   keys.side = nextRandom(state);
+   return keys;
+}
+
+constexpr ZobristKeys ZOBRIST = buildZobrist();
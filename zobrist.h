@@ -0,0 +1,30 @@
+/***********************************************************************
+ * Header File:
+ *    ZOBRIST
+ * Author:
+ *    Jessen Forbush and Roger Galan
+ * Summary:
+ *    The random keys that are XORed together to make a 64-bit hash of
+ *    a position: one per piece code per square, one for black to move,
+ *    one per set of castle rights and one per en-passant file
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include "pieceType.h"
+
+/***************************************************
+ * ZOBRIST KEYS
+ * Built at compile time from a fixed seed, so a given
+ * position hashes the same on every run and every machine
+ **************************************************/
+struct ZobristKeys
+{
+   uint64_t piece[16][64];    // indexed by PieceCode then location
+   uint64_t castle[16];       // indexed by CastleRights
+   uint64_t enPassant[8];     // indexed by the file of the en-passant square
+   uint64_t side;             // XORed in when black is to move
+};
+
+extern const ZobristKeys ZOBRIST;